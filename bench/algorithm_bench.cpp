@@ -0,0 +1,121 @@
+#include <circbuf/algorithm.hpp>
+#include <circbuf/circbuf.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+static constexpr std::size_t g_capacity = 4096;
+
+static auto make_vector()
+{
+    auto vector = std::vector<std::uint32_t>(g_capacity);
+    std::iota(vector.begin(), vector.end(), 0u);
+    return vector;
+}
+
+static auto make_buffer()
+{
+    auto buffer = circbuf::CircBuf<std::uint32_t>{ g_capacity };
+    for (std::uint32_t i = 0; i < g_capacity + g_capacity / 2; ++i) {
+        buffer.push_back(i);    // wraps around so that the head is in the middle of the buffer
+    }
+    return buffer;
+}
+
+// reference: the same algorithm over a std::vector
+static void accumulate_vector(benchmark::State& state)
+{
+    auto vector = make_vector();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(vector.begin(), vector.end(), std::uint32_t{ 0 }));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g_capacity));
+}
+
+static void accumulate_std(benchmark::State& state)
+{
+    auto buffer = make_buffer();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(buffer.begin(), buffer.end(), std::uint32_t{ 0 }));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g_capacity));
+}
+
+static void accumulate_segmented(benchmark::State& state)
+{
+    auto buffer = make_buffer();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(circbuf::accumulate(buffer, std::uint32_t{ 0 }));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g_capacity));
+}
+
+static void copy_vector(benchmark::State& state)
+{
+    auto vector = make_vector();
+    auto out    = std::vector<std::uint32_t>(g_capacity);
+    for (auto _ : state) {
+        std::copy(vector.begin(), vector.end(), out.begin());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g_capacity));
+}
+
+static void copy_std(benchmark::State& state)
+{
+    auto buffer = make_buffer();
+    auto out    = std::vector<std::uint32_t>(g_capacity);
+    for (auto _ : state) {
+        std::copy(buffer.begin(), buffer.end(), out.begin());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g_capacity));
+}
+
+static void copy_segmented(benchmark::State& state)
+{
+    auto buffer = make_buffer();
+    auto out    = std::vector<std::uint32_t>(g_capacity);
+    for (auto _ : state) {
+        circbuf::copy(buffer, out.begin());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g_capacity));
+}
+
+static void find_std(benchmark::State& state)
+{
+    auto buffer = make_buffer();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::find(buffer.begin(), buffer.end(), std::uint32_t{ 0 }));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g_capacity));
+}
+
+static void find_segmented(benchmark::State& state)
+{
+    auto buffer = make_buffer();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(circbuf::find(buffer, std::uint32_t{ 0 }));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g_capacity));
+}
+
+BENCHMARK(accumulate_vector);
+BENCHMARK(accumulate_std);
+BENCHMARK(accumulate_segmented);
+
+BENCHMARK(copy_vector);
+BENCHMARK(copy_std);
+BENCHMARK(copy_segmented);
+
+// the value is not in the buffer, the whole buffer is searched
+BENCHMARK(find_std);
+BENCHMARK(find_segmented);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,137 @@
+#include <circbuf/broadcast_ring.hpp>
+#include <circbuf/spsc_queue.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+static constexpr std::size_t g_capacity = 1024;
+static constexpr std::size_t g_batch    = 64;
+
+// the setup we are replacing: the producer copies every element into one SpscQueue per consumer
+class FanOut
+{
+public:
+    explicit FanOut(std::size_t consumers)
+    {
+        for (std::size_t i = 0; i < consumers; ++i) {
+            m_queues.push_back(std::make_unique<circbuf::SpscQueue<std::uint64_t>>(g_capacity));
+        }
+    }
+
+    void push(std::uint64_t value)
+    {
+        for (auto& queue : m_queues) {
+            while (not queue->try_push(value)) { }
+        }
+    }
+
+    std::uint64_t consume(std::size_t consumer)
+    {
+        auto sum = std::uint64_t{ 0 };
+        for (std::size_t i = 0; i < g_batch; ++i) {
+            auto value = m_queues[consumer]->try_pop();
+            while (not value.has_value()) {
+                value = m_queues[consumer]->try_pop();
+            }
+            sum += *value;
+        }
+        return sum;
+    }
+
+private:
+    std::vector<std::unique_ptr<circbuf::SpscQueue<std::uint64_t>>> m_queues;
+};
+
+// every consumer sees the same elements in place, either consumed a batch at a time straight from the ring (peek)
+// or copied out a batch at a time (read)
+template <bool Peek>
+class Broadcast
+{
+public:
+    explicit Broadcast(std::size_t consumers)
+        : m_ring{ g_capacity, std::vector<circbuf::CursorPolicy>(consumers, circbuf::CursorPolicy::Gating) }
+    {
+    }
+
+    void push(std::uint64_t value) { m_ring.push(value); }
+
+    std::uint64_t consume(std::size_t consumer)
+    {
+        auto sum  = std::uint64_t{ 0 };
+        auto left = g_batch;
+        auto out  = std::array<std::uint64_t, g_batch>{};
+
+        while (left > 0) {
+            if constexpr (Peek) {
+                auto segments = m_ring.peek(consumer);
+                auto count    = std::min(left, segments.size());
+                auto first    = std::min(count, segments.first.size());
+
+                for (std::size_t i = 0; i < first; ++i) {
+                    sum += segments.first[i];
+                }
+                for (std::size_t i = 0; i < count - first; ++i) {
+                    sum += segments.second[i];
+                }
+                m_ring.consume(consumer, count);
+                left -= count;
+            } else {
+                auto count = m_ring.read(consumer, std::span{ out }.first(left));
+                for (std::size_t i = 0; i < count; ++i) {
+                    sum += out[i];
+                }
+                left -= count;
+            }
+        }
+        return sum;
+    }
+
+private:
+    circbuf::BroadcastRing<std::uint64_t> m_ring;
+};
+
+template <typename Ring>
+static std::unique_ptr<Ring> g_ring;
+
+// thread 0 is the producer, every other thread is a consumer that must see every element; every thread runs the
+// same number of iterations so each iteration is one batch for everyone
+template <typename Ring>
+static void broadcast(benchmark::State& state)
+{
+    auto consumers = static_cast<std::size_t>(state.threads()) - 1;
+    if (state.thread_index() == 0) {
+        g_ring<Ring> = std::make_unique<Ring>(consumers);
+    }
+
+    auto sum = std::uint64_t{ 0 };
+    auto i   = std::uint64_t{ 0 };
+
+    for (auto _ : state) {
+        if (state.thread_index() == 0) {
+            for (std::size_t n = 0; n < g_batch; ++n) {
+                g_ring<Ring>->push(i++);
+            }
+        } else {
+            sum += g_ring<Ring>->consume(static_cast<std::size_t>(state.thread_index()) - 1);
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g_batch));
+
+    if (state.thread_index() == 0) {
+        g_ring<Ring>.reset();
+    }
+}
+
+BENCHMARK(broadcast<FanOut>)->DenseThreadRange(2, 9, 1)->UseRealTime();
+BENCHMARK(broadcast<Broadcast<true>>)->DenseThreadRange(2, 9, 1)->UseRealTime();
+BENCHMARK(broadcast<Broadcast<false>>)->DenseThreadRange(2, 9, 1)->UseRealTime();
+
+BENCHMARK_MAIN();
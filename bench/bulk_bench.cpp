@@ -0,0 +1,93 @@
+#include <circbuf/circbuf.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+static constexpr std::size_t g_capacity = 64 * 1024;
+static constexpr std::size_t g_packet   = 4 * 1024;
+
+// capacity is not a multiple of the packet size so the packets end up split across the wrap around
+static auto make_buffer()
+{
+    auto buffer = circbuf::CircBuf<std::byte>{ g_capacity + 123 };
+    for (std::size_t i = 0; i < g_capacity / 2; ++i) {
+        buffer.push_back(std::byte{ 0 });
+    }
+    return buffer;
+}
+
+static auto make_packet()
+{
+    auto packet = std::vector<std::byte>(g_packet);
+    for (std::size_t i = 0; i < packet.size(); ++i) {
+        packet[i] = static_cast<std::byte>(i);
+    }
+    return packet;
+}
+
+static void push_back_loop(benchmark::State& state)
+{
+    auto buffer = make_buffer();
+    auto packet = make_packet();
+
+    for (auto _ : state) {
+        for (auto byte : packet) {
+            buffer.push_back(byte);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(g_packet));
+}
+
+static void push_back_range(benchmark::State& state)
+{
+    auto buffer = make_buffer();
+    auto packet = make_packet();
+
+    for (auto _ : state) {
+        buffer.push_back_range(packet);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(g_packet));
+}
+
+static void pop_front_loop(benchmark::State& state)
+{
+    auto buffer = make_buffer();
+    auto packet = make_packet();
+
+    for (auto _ : state) {
+        buffer.push_back_range(packet);
+        for (auto& byte : packet) {
+            byte = buffer.pop_front();
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(g_packet));
+}
+
+static void pop_front_n(benchmark::State& state)
+{
+    auto buffer = make_buffer();
+    auto packet = make_packet();
+
+    for (auto _ : state) {
+        buffer.push_back_range(packet);
+        buffer.pop_front_n(packet);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(g_packet));
+}
+
+BENCHMARK(push_back_loop);
+BENCHMARK(push_back_range);
+
+// both include a push_back_range to refill the buffer
+BENCHMARK(pop_front_loop);
+BENCHMARK(pop_front_n);
+
+BENCHMARK_MAIN();
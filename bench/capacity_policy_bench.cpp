@@ -0,0 +1,93 @@
+#include <circbuf/circbuf.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+using circbuf::BufferCapacityPolicy;
+
+// capacity that is not a power of two so the Exact policy has to wrap around by comparison
+static constexpr std::size_t g_capacity = 1000;
+
+template <BufferCapacityPolicy C>
+auto make_buffer()
+{
+    auto buffer = circbuf::CircBuf<std::uint64_t, C>{ g_capacity };
+    for (std::uint64_t i = 0; i < buffer.capacity() + buffer.capacity() / 2; ++i) {
+        buffer.push_back(i);    // wraps around so that the head is in the middle of the buffer
+    }
+    return buffer;
+}
+
+// reference: what the index arithmetic costs when done with a modulo
+static void modulo_baseline_at(benchmark::State& state)
+{
+    auto buffer = std::vector<std::uint64_t>(g_capacity, 1);
+    auto head   = g_capacity / 2;
+    benchmark::DoNotOptimize(head);
+
+    for (auto _ : state) {
+        auto sum = std::uint64_t{ 0 };
+        for (std::size_t i = 0; i < buffer.size(); ++i) {
+            sum += buffer[(head + i) % buffer.size()];
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+
+template <BufferCapacityPolicy C>
+static void circbuf_at(benchmark::State& state)
+{
+    auto buffer = make_buffer<C>();
+
+    for (auto _ : state) {
+        auto sum = std::uint64_t{ 0 };
+        for (std::size_t i = 0; i < buffer.size(); ++i) {
+            sum += buffer.at(i);
+        }
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+
+template <BufferCapacityPolicy C>
+static void circbuf_push_pop(benchmark::State& state)
+{
+    auto buffer = make_buffer<C>();
+    auto value  = std::uint64_t{ 0 };
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < g_capacity; ++i) {
+            buffer.push_back(value++);
+            benchmark::DoNotOptimize(buffer.pop_front());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g_capacity));
+}
+
+template <BufferCapacityPolicy C>
+static void circbuf_size(benchmark::State& state)
+{
+    auto buffer = make_buffer<C>();
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(&buffer);
+        benchmark::DoNotOptimize(buffer.size());
+    }
+}
+
+BENCHMARK(modulo_baseline_at);
+
+BENCHMARK(circbuf_at<BufferCapacityPolicy::Exact>);
+BENCHMARK(circbuf_at<BufferCapacityPolicy::PowerOfTwo>);
+
+BENCHMARK(circbuf_push_pop<BufferCapacityPolicy::Exact>);
+BENCHMARK(circbuf_push_pop<BufferCapacityPolicy::PowerOfTwo>);
+
+BENCHMARK(circbuf_size<BufferCapacityPolicy::Exact>);
+BENCHMARK(circbuf_size<BufferCapacityPolicy::PowerOfTwo>);
+
+BENCHMARK_MAIN();
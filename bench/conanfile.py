@@ -0,0 +1,11 @@
+from conan import ConanFile
+from conan.tools.cmake import cmake_layout
+
+
+class Recipe(ConanFile):
+    settings = ["os", "compiler", "build_type", "arch"]
+    generators = ["CMakeToolchain", "CMakeDeps"]
+    requires = ["benchmark/1.8.3"]
+
+    def layout(self):
+        cmake_layout(self)
@@ -0,0 +1,90 @@
+#include <circbuf/circbuf.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+struct Job
+{
+    std::uint64_t m_id;
+    std::uint64_t m_payload[3];
+};
+
+struct Deque
+{
+    std::deque<Job> m_queue;
+
+    void push(Job job) { m_queue.push_back(job); }
+    Job  pop()
+    {
+        auto job = m_queue.front();
+        m_queue.pop_front();
+        return job;
+    }
+};
+
+struct Growing
+{
+    circbuf::CircBuf<Job> m_queue{ 0, circbuf::Growth{} };
+
+    void push(Job job) { m_queue.push_back(job); }
+    Job  pop() { return m_queue.pop_front(); }
+};
+
+// a FIFO job queue: a burst of state.range(0) jobs is pushed while the previous half is still being consumed, the
+// queue is kept alive across the iterations so the growth happens only in the first ones
+template <typename Queue>
+static void job_queue(benchmark::State& state)
+{
+    auto burst = static_cast<std::uint64_t>(state.range(0));
+    auto queue = Queue{};
+    auto sum   = std::uint64_t{ 0 };
+
+    for (std::uint64_t i = 0; i < burst / 2; ++i) {
+        queue.push({ i, {} });
+    }
+
+    for (auto _ : state) {
+        for (std::uint64_t i = 0; i < burst; ++i) {
+            queue.push({ i, {} });
+            if (i % 2 == 0) {
+                sum += queue.pop().m_id;
+            }
+        }
+        for (std::uint64_t i = 0; i < burst / 2; ++i) {
+            sum += queue.pop().m_id;
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+
+// the queue is created empty each time so that every growth is measured
+template <typename Queue>
+static void fill_drain(benchmark::State& state)
+{
+    auto count = static_cast<std::uint64_t>(state.range(0));
+    auto sum   = std::uint64_t{ 0 };
+
+    for (auto _ : state) {
+        auto queue = Queue{};
+        for (std::uint64_t i = 0; i < count; ++i) {
+            queue.push({ i, {} });
+        }
+        for (std::uint64_t i = 0; i < count; ++i) {
+            sum += queue.pop().m_id;
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+
+BENCHMARK_TEMPLATE(job_queue, Deque)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(job_queue, Growing)->Range(1 << 10, 1 << 16);
+
+BENCHMARK_TEMPLATE(fill_drain, Deque)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(fill_drain, Growing)->Range(1 << 10, 1 << 16);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,35 @@
+#include <circbuf/mapped_circbuf.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+
+// 128 MiB of elements, wrapped around in the middle so that both parts have the same size
+static constexpr std::size_t g_size = 16 * 1024 * 1024;
+
+template <typename Buffer>
+static void grow(benchmark::State& state)
+{
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto buffer = Buffer{ g_size };
+        for (std::uint64_t i = 0; i < g_size + g_size / 2; ++i) {
+            buffer.push_back(i);
+        }
+        state.ResumeTiming();
+
+        buffer.resize(g_size * 2);
+        benchmark::ClobberMemory();
+
+        state.PauseTiming();
+        buffer = Buffer{};
+        state.ResumeTiming();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(g_size * sizeof(std::uint64_t)));
+}
+
+BENCHMARK_TEMPLATE(grow, circbuf::CircBuf<std::uint64_t>)->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(grow, circbuf::MappedCircBuf<std::uint64_t>)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,91 @@
+#include <circbuf/circbuf.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+static constexpr std::size_t g_positions = 1024;
+
+// half full so that insert never has to discard anything
+static auto make_buffer(std::size_t size)
+{
+    auto buffer = circbuf::CircBuf<std::uint64_t>{ size * 2 };
+    for (std::uint64_t i = 0; i < size + size / 2; ++i) {
+        buffer.push_back(i);    // wraps around so that the head is in the middle of the buffer
+    }
+    for (std::size_t i = 0; i < size / 2; ++i) {
+        buffer.pop_front();
+    }
+    return buffer;
+}
+
+// uniformly distributed over [0, size)
+static auto make_positions(std::size_t size)
+{
+    auto rng       = std::mt19937_64{ 42 };
+    auto dist      = std::uniform_int_distribution<std::size_t>{ 0, size - 1 };
+    auto positions = std::vector<std::size_t>(g_positions);
+    for (auto& pos : positions) {
+        pos = dist(rng);
+    }
+    return positions;
+}
+
+// each iteration inserts then removes at the same position so the size stays the same
+static void insert_remove(benchmark::State& state)
+{
+    auto size      = static_cast<std::size_t>(state.range(0));
+    auto buffer    = make_buffer(size);
+    auto positions = make_positions(size);
+    auto index     = std::size_t{ 0 };
+
+    for (auto _ : state) {
+        auto pos = positions[index++ % g_positions];
+        buffer.insert(pos, 42);
+        benchmark::DoNotOptimize(buffer.remove(pos));
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+// a run of g_run elements inserted then removed in the middle of a 10000 element buffer
+static constexpr std::size_t g_run = 64;
+
+static void run_one_by_one(benchmark::State& state)
+{
+    auto buffer = make_buffer(10'000);
+    auto pos    = buffer.size() / 3;
+
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < g_run; ++i) {
+            buffer.insert(pos + i, std::uint64_t{ 42 });
+        }
+        for (std::size_t i = 0; i < g_run; ++i) {
+            benchmark::DoNotOptimize(buffer.remove(pos));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g_run) * 2);
+}
+
+static void run_range(benchmark::State& state)
+{
+    auto buffer = make_buffer(10'000);
+    auto pos    = buffer.size() / 3;
+    auto values = std::vector<std::uint64_t>(g_run, 42);
+
+    for (auto _ : state) {
+        buffer.insert_range(pos, values);
+        buffer.erase(pos, pos + g_run);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g_run) * 2);
+}
+
+BENCHMARK(insert_remove)->RangeMultiplier(10)->Range(100, 100'000);
+
+BENCHMARK(run_one_by_one);
+BENCHMARK(run_range);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,107 @@
+#include <circbuf/io.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <unistd.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+static constexpr std::size_t g_capacity = 64 * 1024;
+static constexpr std::size_t g_packet   = 4 * 1024;
+
+// both variants pay for the same write into the pipe, only the way the bytes get into the buffer differs
+struct Pipe
+{
+    std::array<int, 2> m_fds = { -1, -1 };
+
+    Pipe() { ::pipe(m_fds.data()); }
+    ~Pipe()
+    {
+        ::close(m_fds[0]);
+        ::close(m_fds[1]);
+    }
+
+    void fill(const std::vector<std::byte>& packet) { ::write(m_fds[1], packet.data(), packet.size()); }
+};
+
+// capacity is not a multiple of the packet size so the packets end up split across the wrap around
+static auto make_buffer()
+{
+    return circbuf::CircBuf<std::byte>{ g_capacity + 123 };
+}
+
+static void read_into_vector_then_push(benchmark::State& state)
+{
+    auto pipe   = Pipe{};
+    auto buffer = make_buffer();
+    auto packet = std::vector<std::byte>(g_packet);
+    auto tmp    = std::vector<std::byte>(g_packet);
+
+    for (auto _ : state) {
+        pipe.fill(packet);
+        auto count = ::read(pipe.m_fds[0], tmp.data(), tmp.size());
+        buffer.push_back_range(std::span{ tmp }.first(static_cast<std::size_t>(count)));
+        buffer.consume(buffer.size());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(g_packet));
+}
+
+static void readv_into_buffer(benchmark::State& state)
+{
+    auto pipe   = Pipe{};
+    auto buffer = make_buffer();
+    auto packet = std::vector<std::byte>(g_packet);
+
+    for (auto _ : state) {
+        pipe.fill(packet);
+        circbuf::io::read(pipe.m_fds[0], buffer, g_packet);
+        buffer.consume(buffer.size());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(g_packet));
+}
+
+static void pop_into_vector_then_write(benchmark::State& state)
+{
+    auto pipe   = Pipe{};
+    auto buffer = make_buffer();
+    auto packet = std::vector<std::byte>(g_packet);
+    auto tmp    = std::vector<std::byte>(g_packet);
+
+    for (auto _ : state) {
+        buffer.push_back_range(packet);
+        auto count = buffer.pop_front_n(tmp);
+        ::write(pipe.m_fds[1], tmp.data(), count);
+        ::read(pipe.m_fds[0], packet.data(), packet.size());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(g_packet));
+}
+
+static void writev_from_buffer(benchmark::State& state)
+{
+    auto pipe   = Pipe{};
+    auto buffer = make_buffer();
+    auto packet = std::vector<std::byte>(g_packet);
+
+    for (auto _ : state) {
+        buffer.push_back_range(packet);
+        circbuf::io::write(pipe.m_fds[1], buffer);
+        ::read(pipe.m_fds[0], packet.data(), packet.size());
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(g_packet));
+}
+
+BENCHMARK(read_into_vector_then_push);
+BENCHMARK(readv_into_buffer);
+
+// both drain the pipe with a plain read afterwards
+BENCHMARK(pop_into_vector_then_write);
+BENCHMARK(writev_from_buffer);
+
+BENCHMARK_MAIN();
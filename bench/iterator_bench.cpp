@@ -0,0 +1,50 @@
+#include <circbuf/circbuf.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+static constexpr std::size_t g_capacity = 4096;
+
+using Buffer = circbuf::CircBuf<std::uint32_t>;
+
+static auto make_buffer()
+{
+    auto buffer = Buffer{ g_capacity };
+    for (std::uint32_t i = 0; i < g_capacity + g_capacity / 2; ++i) {
+        buffer.push_back(i);    // wraps around so that the head is in the middle of the buffer
+    }
+    return buffer;
+}
+
+// reference: the same loop over a std::vector
+static void accumulate_vector(benchmark::State& state)
+{
+    auto vector = std::vector<std::uint32_t>(g_capacity, 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(vector.begin(), vector.end(), std::uint32_t{ 0 }));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g_capacity));
+}
+
+template <typename Iter>
+static void accumulate(benchmark::State& state)
+{
+    auto buffer = make_buffer();
+    auto first  = Iter{ &buffer, 0 };
+    auto last   = Iter{ &buffer, buffer.size() };
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(std::accumulate(first, last, std::uint32_t{ 0 }));
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g_capacity));
+}
+
+BENCHMARK(accumulate_vector);
+BENCHMARK(accumulate<Buffer::Iterator<false>>);
+BENCHMARK(accumulate<Buffer::UncheckedIterator<false>>);
+
+BENCHMARK_MAIN();
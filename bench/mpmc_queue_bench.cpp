@@ -0,0 +1,107 @@
+#include <circbuf/circbuf.hpp>
+#include <circbuf/mpmc_queue.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+static constexpr std::size_t g_capacity = 1024;
+
+// the setup we are replacing: CircBuf guarded by a mutex, with the same try_push/try_pop surface
+class MutexQueue
+{
+public:
+    explicit MutexQueue(std::size_t capacity)
+        : m_buffer{ capacity, circbuf::BufferPolicy::ThrowOnFull }
+    {
+    }
+
+    bool try_push(std::uint64_t value)
+    {
+        auto lock = std::scoped_lock{ m_mutex };
+        if (m_buffer.full()) {
+            return false;
+        }
+        m_buffer.push_back(value);
+        return true;
+    }
+
+    std::optional<std::uint64_t> try_pop()
+    {
+        auto lock = std::scoped_lock{ m_mutex };
+        if (m_buffer.empty()) {
+            return std::nullopt;
+        }
+        return m_buffer.pop_front();
+    }
+
+private:
+    std::mutex                       m_mutex;
+    circbuf::CircBuf<std::uint64_t> m_buffer;
+};
+
+using MpmcQueue = circbuf::MpmcQueue<std::uint64_t>;
+
+template <typename Queue>
+static std::unique_ptr<Queue> g_queue;
+
+// every thread is both a producer and a consumer: push a value then pop one, so the queue never runs dry or fills
+// up and the contention grows with the number of threads
+template <typename Queue>
+static void push_pop(benchmark::State& state)
+{
+    if (state.thread_index() == 0) {
+        g_queue<Queue> = std::make_unique<Queue>(g_capacity);
+    }
+
+    auto sum = std::uint64_t{ 0 };
+    auto i   = std::uint64_t{ 0 };
+
+    for (auto _ : state) {
+        while (not g_queue<Queue>->try_push(i++)) { }
+
+        auto value = g_queue<Queue>->try_pop();
+        while (not value.has_value()) {
+            value = g_queue<Queue>->try_pop();
+        }
+        sum += *value;
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * 2);
+
+    if (state.thread_index() == 0) {
+        g_queue<Queue>.reset();
+    }
+}
+
+// same with the blocking push and pop of MpmcQueue: a ticket is taken unconditionally instead of retried
+static void push_pop_blocking(benchmark::State& state)
+{
+    if (state.thread_index() == 0) {
+        g_queue<MpmcQueue> = std::make_unique<MpmcQueue>(g_capacity);
+    }
+
+    auto sum = std::uint64_t{ 0 };
+    auto i   = std::uint64_t{ 0 };
+
+    for (auto _ : state) {
+        g_queue<MpmcQueue>->push(i++);
+        sum += g_queue<MpmcQueue>->pop();
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(state.iterations() * 2);
+
+    if (state.thread_index() == 0) {
+        g_queue<MpmcQueue>.reset();
+    }
+}
+
+BENCHMARK(push_pop<MutexQueue>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(push_pop<MpmcQueue>)->ThreadRange(1, 32)->UseRealTime();
+BENCHMARK(push_pop_blocking)->ThreadRange(1, 32)->UseRealTime();
+
+BENCHMARK_MAIN();
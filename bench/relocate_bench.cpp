@@ -0,0 +1,95 @@
+#include <circbuf/circbuf.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+// same layout, only Relocatable opts in as trivially relocatable
+template <bool Relocatable>
+struct Handle
+{
+    std::unique_ptr<std::uint64_t> m_value;
+
+    Handle(std::uint64_t value)
+        : m_value{ std::make_unique<std::uint64_t>(value) }
+    {
+    }
+};
+
+template <>
+struct circbuf::IsTriviallyRelocatable<Handle<true>> : std::true_type
+{
+};
+
+static constexpr std::size_t g_size = 10'000;
+
+// three quarter full and wrapped around so that linearize has to move both parts
+template <typename T>
+static auto make_buffer()
+{
+    auto buffer = circbuf::CircBuf<T>{ g_size };
+    for (std::uint64_t i = 0; i < g_size + g_size / 2; ++i) {
+        buffer.push_back(i);
+    }
+    for (std::size_t i = 0; i < g_size / 4; ++i) {
+        buffer.pop_front();
+    }
+    return buffer;
+}
+
+template <typename T>
+static void resize(benchmark::State& state)
+{
+    auto buffer = make_buffer<T>();
+
+    for (auto _ : state) {
+        buffer.resize(g_size * 2);
+        buffer.resize(g_size);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * 2 * static_cast<std::int64_t>(buffer.size()));
+}
+
+template <typename T>
+static void linearize(benchmark::State& state)
+{
+    auto buffer = make_buffer<T>();
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        for (std::size_t i = 0; i < g_size / 2; ++i) {
+            buffer.push_back(buffer.pop_front());    // wrap around again
+        }
+        state.ResumeTiming();
+
+        buffer.linearize();
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(buffer.size()));
+}
+
+template <typename T>
+static void insert_remove(benchmark::State& state)
+{
+    auto buffer = make_buffer<T>();
+    auto pos    = buffer.size() / 3;
+
+    for (auto _ : state) {
+        buffer.insert(pos, 42);
+        benchmark::DoNotOptimize(buffer.remove(pos));
+    }
+    state.SetItemsProcessed(state.iterations() * 2);
+}
+
+BENCHMARK_TEMPLATE(resize, Handle<false>);
+BENCHMARK_TEMPLATE(resize, Handle<true>);
+
+BENCHMARK_TEMPLATE(linearize, Handle<false>);
+BENCHMARK_TEMPLATE(linearize, Handle<true>);
+
+BENCHMARK_TEMPLATE(insert_remove, Handle<false>);
+BENCHMARK_TEMPLATE(insert_remove, Handle<true>);
+
+BENCHMARK_MAIN();
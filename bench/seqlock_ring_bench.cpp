@@ -0,0 +1,93 @@
+#include <circbuf/circbuf.hpp>
+#include <circbuf/seqlock_ring.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+
+static constexpr std::size_t g_capacity = 1024;
+static constexpr std::size_t g_window   = 64;
+
+struct Sample
+{
+    std::uint64_t                timestamp;
+    std::array<std::uint64_t, 3> values;
+};
+
+// the setup we are replacing: a ReplaceOnFull CircBuf guarded by a mutex, the readers copy the last entries out
+class MutexRing
+{
+public:
+    explicit MutexRing(std::size_t capacity)
+        : m_buffer{ capacity, circbuf::BufferPolicy::ReplaceOnFull }
+    {
+    }
+
+    void push(const Sample& value)
+    {
+        auto lock = std::scoped_lock{ m_mutex };
+        m_buffer.push_back(value);
+    }
+
+    std::size_t snapshot(std::span<Sample> out)
+    {
+        auto lock  = std::scoped_lock{ m_mutex };
+        auto count = std::min(out.size(), m_buffer.size());
+        std::copy(m_buffer.end() - static_cast<std::ptrdiff_t>(count), m_buffer.end(), out.begin());
+        return count;
+    }
+
+private:
+    std::mutex               m_mutex;
+    circbuf::CircBuf<Sample> m_buffer;
+};
+
+using SeqlockRing = circbuf::SeqlockRing<Sample>;
+
+template <typename Ring>
+static std::unique_ptr<Ring> g_ring;
+
+// thread 0 keeps writing, every other thread reads the latest g_window entries; only the reads are counted
+template <typename Ring>
+static void read_latest(benchmark::State& state)
+{
+    if (state.thread_index() == 0) {
+        g_ring<Ring> = std::make_unique<Ring>(g_capacity);
+        for (std::size_t i = 0; i < g_capacity; ++i) {
+            g_ring<Ring>->push(Sample{ i, {} });
+        }
+    }
+
+    auto out = std::array<Sample, g_window>{};
+    auto sum = std::uint64_t{ 0 };
+    auto i   = std::uint64_t{ g_capacity };
+
+    for (auto _ : state) {
+        if (state.thread_index() == 0) {
+            for (std::size_t n = 0; n < g_window; ++n) {
+                g_ring<Ring>->push(Sample{ i++, {} });
+            }
+        } else {
+            auto count = g_ring<Ring>->snapshot(out);
+            sum       += out[count - 1].timestamp;
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+
+    if (state.thread_index() == 0) {
+        g_ring<Ring>.reset();
+    } else {
+        state.SetItemsProcessed(state.iterations());
+    }
+}
+
+BENCHMARK(read_latest<MutexRing>)->DenseThreadRange(2, 9, 1)->UseRealTime();
+BENCHMARK(read_latest<SeqlockRing>)->DenseThreadRange(2, 9, 1)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,111 @@
+#include <circbuf/circbuf.hpp>
+#include <circbuf/spsc_queue.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+static constexpr std::size_t   g_capacity = 1024;
+static constexpr std::uint64_t g_count    = 1 << 20;
+
+// the setup we are replacing: CircBuf guarded by a mutex, with the same try_push/try_pop surface
+class MutexQueue
+{
+public:
+    explicit MutexQueue(std::size_t capacity)
+        : m_buffer{ capacity, circbuf::BufferPolicy::ThrowOnFull }
+    {
+    }
+
+    bool try_push(std::uint64_t value)
+    {
+        auto lock = std::scoped_lock{ m_mutex };
+        if (m_buffer.full()) {
+            return false;
+        }
+        m_buffer.push_back(value);
+        return true;
+    }
+
+    std::optional<std::uint64_t> try_pop()
+    {
+        auto lock = std::scoped_lock{ m_mutex };
+        if (m_buffer.empty()) {
+            return std::nullopt;
+        }
+        return m_buffer.pop_front();
+    }
+
+private:
+    std::mutex                       m_mutex;
+    circbuf::CircBuf<std::uint64_t> m_buffer;
+};
+
+using SpscQueue = circbuf::SpscQueue<std::uint64_t>;
+
+// one producer pushing g_count values while one consumer pops them
+template <typename Queue>
+static void throughput(benchmark::State& state)
+{
+    for (auto _ : state) {
+        auto queue    = Queue{ g_capacity };
+        auto consumer = std::jthread{ [&] {
+            auto sum = std::uint64_t{ 0 };
+            for (std::uint64_t received = 0; received < g_count;) {
+                if (auto value = queue.try_pop(); value.has_value()) {
+                    sum += *value;
+                    ++received;
+                }
+            }
+            benchmark::DoNotOptimize(sum);
+        } };
+
+        for (std::uint64_t i = 0; i < g_count; ++i) {
+            while (not queue.try_push(i)) { }
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(g_count));
+}
+
+// round trip of a single value through a pair of queues, an echo thread sends back what it receives
+template <typename Queue>
+static void latency(benchmark::State& state)
+{
+    auto ping = Queue{ g_capacity };
+    auto pong = Queue{ g_capacity };
+    auto stop = std::atomic<bool>{ false };
+
+    auto echo = std::jthread{ [&] {
+        while (not stop.load(std::memory_order::relaxed)) {
+            if (auto value = ping.try_pop(); value.has_value()) {
+                while (not pong.try_push(*value)) { }
+            }
+        }
+    } };
+
+    auto value = std::uint64_t{ 0 };
+    for (auto _ : state) {
+        while (not ping.try_push(value)) { }
+
+        auto result = std::optional<std::uint64_t>{};
+        while (not (result = pong.try_pop()).has_value()) { }
+
+        benchmark::DoNotOptimize(result);
+        ++value;
+    }
+
+    stop.store(true, std::memory_order::relaxed);
+}
+
+BENCHMARK(throughput<MutexQueue>)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(throughput<SpscQueue>)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+BENCHMARK(latency<MutexQueue>)->UseRealTime();
+BENCHMARK(latency<SpscQueue>)->UseRealTime();
+
+BENCHMARK_MAIN();
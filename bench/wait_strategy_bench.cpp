@@ -0,0 +1,73 @@
+#include <circbuf/spsc_queue.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+static constexpr std::size_t g_capacity = 1024;
+
+// process CPU time is measured next to the real time: CPU / real time is the number of cores kept busy
+
+// round trip through two queues and an echo thread: the latency when the other side is always about to answer
+template <circbuf::WaitStrategy W>
+static void ping_pong(benchmark::State& state)
+{
+    auto ping = circbuf::SpscQueue<std::int64_t, W>{ g_capacity };
+    auto pong = circbuf::SpscQueue<std::int64_t, W>{ g_capacity };
+
+    auto echo = std::jthread{ [&] {
+        for (auto value = ping.pop(); value >= 0; value = ping.pop()) {
+            pong.push(value);
+        }
+    } };
+
+    auto i = std::int64_t{ 0 };
+    for (auto _ : state) {
+        ping.push(i++);
+        benchmark::DoNotOptimize(pong.pop());
+    }
+
+    ping.push(-1);
+}
+
+// a quiet shard: a message every 50us, the consumer waits for it in pop; reports how long it took the consumer to
+// see the message and the CPU it burned in the meantime
+template <circbuf::WaitStrategy W>
+static void quiet(benchmark::State& state)
+{
+    using Clock = std::chrono::steady_clock;
+
+    auto queue   = circbuf::SpscQueue<std::int64_t, W>{ g_capacity };
+    auto latency = std::int64_t{ 0 };
+    auto count   = std::int64_t{ 0 };
+
+    auto consumer = std::jthread{ [&] {
+        for (auto sent = queue.pop(); sent >= 0; sent = queue.pop()) {
+            latency += Clock::now().time_since_epoch().count() - sent;
+            ++count;
+        }
+    } };
+
+    for (auto _ : state) {
+        std::this_thread::sleep_for(std::chrono::microseconds{ 50 });
+        queue.push(Clock::now().time_since_epoch().count());
+    }
+
+    queue.push(-1);
+    consumer.join();
+
+    auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::duration{ latency }).count();
+    state.counters["wake_ns"] = count == 0 ? 0.0 : static_cast<double>(ns) / static_cast<double>(count);
+}
+
+BENCHMARK(ping_pong<circbuf::SpinWait>)->UseRealTime()->MeasureProcessCPUTime();
+BENCHMARK(ping_pong<circbuf::YieldWait>)->UseRealTime()->MeasureProcessCPUTime();
+BENCHMARK(ping_pong<circbuf::ParkWait>)->UseRealTime()->MeasureProcessCPUTime();
+
+BENCHMARK(quiet<circbuf::SpinWait>)->UseRealTime()->MeasureProcessCPUTime();
+BENCHMARK(quiet<circbuf::YieldWait>)->UseRealTime()->MeasureProcessCPUTime();
+BENCHMARK(quiet<circbuf::ParkWait>)->UseRealTime()->MeasureProcessCPUTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,100 @@
+#include <circbuf/circbuf.hpp>
+#include <circbuf/work_stealing_deque.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+
+static constexpr std::size_t g_capacity = 64;
+static constexpr std::size_t g_batch    = 256;
+
+// the setup we are replacing: a growing CircBuf guarded by a mutex, the owner works on the back, thieves on the front
+class MutexDeque
+{
+public:
+    explicit MutexDeque(std::size_t capacity)
+        : m_buffer{ capacity, circbuf::Growth{} }
+    {
+    }
+
+    void push(std::uint64_t value)
+    {
+        auto lock = std::scoped_lock{ m_mutex };
+        m_buffer.push_back(value);
+    }
+
+    std::optional<std::uint64_t> pop()
+    {
+        auto lock = std::scoped_lock{ m_mutex };
+        if (m_buffer.empty()) {
+            return std::nullopt;
+        }
+        return m_buffer.pop_back();
+    }
+
+    std::optional<std::uint64_t> steal()
+    {
+        auto lock = std::scoped_lock{ m_mutex };
+        if (m_buffer.empty()) {
+            return std::nullopt;
+        }
+        return m_buffer.pop_front();
+    }
+
+private:
+    std::mutex                      m_mutex;
+    circbuf::CircBuf<std::uint64_t> m_buffer;
+};
+
+using WorkStealingDeque = circbuf::WorkStealingDeque<std::uint64_t>;
+
+template <typename Deque>
+static std::unique_ptr<Deque> g_deque;
+
+// thread 0 is the owner of a thread pool worker: it pushes a batch of tasks then runs them until its deque is empty,
+// every other thread is an idle worker stealing from it; counts the tasks taken by everyone
+template <typename Deque>
+static void push_pop_steal(benchmark::State& state)
+{
+    if (state.thread_index() == 0) {
+        g_deque<Deque> = std::make_unique<Deque>(g_capacity);
+    }
+
+    auto sum   = std::uint64_t{ 0 };
+    auto taken = std::int64_t{ 0 };
+    auto i     = std::uint64_t{ 0 };
+
+    for (auto _ : state) {
+        if (state.thread_index() == 0) {
+            for (std::size_t n = 0; n < g_batch; ++n) {
+                g_deque<Deque>->push(i++);
+            }
+            for (auto value = g_deque<Deque>->pop(); value.has_value(); value = g_deque<Deque>->pop()) {
+                sum += *value;
+                ++taken;
+            }
+        } else {
+            for (std::size_t n = 0; n < g_batch; ++n) {
+                if (auto value = g_deque<Deque>->steal(); value.has_value()) {
+                    sum += *value;
+                    ++taken;
+                }
+            }
+        }
+    }
+    benchmark::DoNotOptimize(sum);
+    state.SetItemsProcessed(taken);
+
+    if (state.thread_index() == 0) {
+        g_deque<Deque>.reset();
+    }
+}
+
+BENCHMARK(push_pop_steal<MutexDeque>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK(push_pop_steal<WorkStealingDeque>)->ThreadRange(1, 16)->UseRealTime();
+
+BENCHMARK_MAIN();
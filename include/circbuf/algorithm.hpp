@@ -0,0 +1,128 @@
+#ifndef CIRCBUF_ALGORITHM_HPP
+#define CIRCBUF_ALGORITHM_HPP
+
+#include "circbuf/circbuf.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <utility>
+
+// algorithms that walk the at most two contiguous segments of a CircBuf with plain pointer loops instead of going
+// through CircBuf::Iterator on every element, other iterators are forwarded to the std algorithms
+//
+// call them qualified (circbuf::copy), an unqualified call may be ambiguous with the std ones found through ADL
+
+namespace circbuf
+{
+    // iterator pair that can be split into contiguous segments with segments(first, last)
+    template <typename It>
+    concept SegmentedIterator = std::random_access_iterator<It> and requires (const It& first, const It& last) {
+        { segments(first, last).first.data() } -> std::same_as<typename std::iterator_traits<It>::pointer>;
+        { segments(first, last).second.data() } -> std::same_as<typename std::iterator_traits<It>::pointer>;
+    };
+
+    template <std::input_iterator It, std::weakly_incrementable Out>
+    Out copy(It first, It last, Out out)
+    {
+        if constexpr (SegmentedIterator<It>) {
+            auto [head, tail] = segments(first, last);
+            out               = std::copy(head.data(), head.data() + head.size(), std::move(out));
+            return std::copy(tail.data(), tail.data() + tail.size(), std::move(out));
+        } else {
+            return std::copy(first, last, std::move(out));
+        }
+    }
+
+    template <std::ranges::input_range R, std::weakly_incrementable Out>
+    Out copy(R&& range, Out out)
+    {
+        return circbuf::copy(std::ranges::begin(range), std::ranges::end(range), std::move(out));
+    }
+
+    template <std::forward_iterator It, typename V>
+    void fill(It first, It last, const V& value)
+    {
+        if constexpr (SegmentedIterator<It>) {
+            auto [head, tail] = segments(first, last);
+            std::fill(head.data(), head.data() + head.size(), value);
+            std::fill(tail.data(), tail.data() + tail.size(), value);
+        } else {
+            std::fill(first, last, value);
+        }
+    }
+
+    template <std::ranges::forward_range R, typename V>
+    void fill(R&& range, const V& value)
+    {
+        circbuf::fill(std::ranges::begin(range), std::ranges::end(range), value);
+    }
+
+    template <std::input_iterator It, typename V>
+    It find(It first, It last, const V& value)
+    {
+        if constexpr (SegmentedIterator<It>) {
+            auto [head, tail] = segments(first, last);
+
+            auto found = std::find(head.data(), head.data() + head.size(), value);
+            if (found != head.data() + head.size()) {
+                return first + (found - head.data());
+            }
+
+            found = std::find(tail.data(), tail.data() + tail.size(), value);
+            if (found != tail.data() + tail.size()) {
+                return first + static_cast<std::ptrdiff_t>(head.size()) + (found - tail.data());
+            }
+
+            return last;
+        } else {
+            return std::find(first, last, value);
+        }
+    }
+
+    template <std::ranges::input_range R, typename V>
+    std::ranges::iterator_t<R> find(R&& range, const V& value)
+    {
+        return circbuf::find(std::ranges::begin(range), std::ranges::end(range), value);
+    }
+
+    template <std::input_iterator It, typename Fn>
+    Fn for_each(It first, It last, Fn fn)
+    {
+        if constexpr (SegmentedIterator<It>) {
+            auto [head, tail] = segments(first, last);
+            auto rest         = std::for_each(head.data(), head.data() + head.size(), std::move(fn));
+            return std::for_each(tail.data(), tail.data() + tail.size(), std::move(rest));
+        } else {
+            return std::for_each(first, last, std::move(fn));
+        }
+    }
+
+    template <std::ranges::input_range R, typename Fn>
+    Fn for_each(R&& range, Fn fn)
+    {
+        return circbuf::for_each(std::ranges::begin(range), std::ranges::end(range), std::move(fn));
+    }
+
+    template <std::input_iterator It, typename V, typename Op = std::plus<>>
+    V accumulate(It first, It last, V init, Op op = {})
+    {
+        if constexpr (SegmentedIterator<It>) {
+            auto [head, tail] = segments(first, last);
+            init              = std::accumulate(head.data(), head.data() + head.size(), std::move(init), op);
+            return std::accumulate(tail.data(), tail.data() + tail.size(), std::move(init), op);
+        } else {
+            return std::accumulate(first, last, std::move(init), op);
+        }
+    }
+
+    template <std::ranges::input_range R, typename V, typename Op = std::plus<>>
+    V accumulate(R&& range, V init, Op op = {})
+    {
+        return circbuf::accumulate(std::ranges::begin(range), std::ranges::end(range), std::move(init), op);
+    }
+}
+
+#endif /* end of include guard: CIRCBUF_ALGORITHM_HPP */
@@ -0,0 +1,364 @@
+#ifndef CIRCBUF_BROADCAST_RING_HPP
+#define CIRCBUF_BROADCAST_RING_HPP
+
+#include "circbuf/circbuf.hpp"    // for Segments
+#include "circbuf/concurrent.hpp"
+#include "circbuf/detail/cache_line.hpp"
+#include "circbuf/detail/raw_buffer.hpp"
+#include "circbuf/error.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace circbuf
+{
+    // how a consumer of a BroadcastRing keeps up with the producer
+    enum class CursorPolicy
+    {
+        Gating,    // the producer never overwrites what it hasn't consumed yet (like BufferPolicy::ThrowOnFull)
+        Lossy,     // the producer overwrites what it hasn't read yet (like BufferPolicy::ReplaceOnFull)
+    };
+
+    // single-producer broadcast ring (Disruptor): every element pushed is seen by every consumer, each consumer has
+    // its own cursor into the same elements so nothing is copied per consumer
+    // - the consumers are fixed at construction and referred to by their index
+    // - only one thread at a time may call the producer side functions: try_push, try_emplace, push, emplace
+    // - only one thread at a time may call the consumer side functions of a given consumer: peek, consume, read
+    // - the producer is gated by the slowest Gating consumer, Lossy consumers skip what they missed and count it
+    // - the blocking functions wait for the other side according to W
+    template <ConcurrentElement T, WaitStrategy W = YieldWait>
+    class BroadcastRing
+    {
+    public:
+        using Element = T;
+
+        // STL compatibility/compliance [breaking my style, big sad...]
+        using value_type = Element;
+        using size_type  = std::size_t;
+
+        // capacity is rounded up to the next power of two, one consumer per policy in consumers
+        // - Lossy consumers can only read, so they need a trivially copyable T (throws error::InvalidPolicy if not)
+        BroadcastRing(std::size_t capacity, std::span<const CursorPolicy> consumers);
+        BroadcastRing(std::size_t capacity, std::initializer_list<CursorPolicy> consumers)
+            : BroadcastRing{ capacity, std::span{ consumers.begin(), consumers.size() } }
+        {
+        }
+        ~BroadcastRing();
+
+        BroadcastRing(BroadcastRing&&)                 = delete;
+        BroadcastRing& operator=(BroadcastRing&&)      = delete;
+        BroadcastRing(const BroadcastRing&)            = delete;
+        BroadcastRing& operator=(const BroadcastRing&) = delete;
+
+        // producer side, returns false when the slowest Gating consumer is capacity() elements behind
+        template <typename... Ts>
+        bool try_emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>);
+
+        bool try_push(T&& value) noexcept { return try_emplace(std::move(value)); }
+        bool try_push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
+            requires std::copy_constructible<T>
+        {
+            return try_emplace(value);
+        }
+
+        // producer side, wait until the slowest Gating consumer makes room
+        template <typename... Ts>
+        void emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>);
+
+        void push(T&& value) noexcept { emplace(std::move(value)); }
+        void push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
+            requires std::copy_constructible<T>
+        {
+            emplace(value);
+        }
+
+        // Gating consumer side: every element published since the cursor of consumer, in place and in at most two
+        // segments, they stay valid until consume moves the cursor past them
+        // - the producer may overwrite the elements of a Lossy consumer at any time: peek returns empty segments and
+        //   consume throws error::InvalidPolicy for it
+        Segments<const T> peek(std::size_t consumer) const noexcept;
+        void              consume(std::size_t consumer, std::size_t count);
+
+        // consumer side, Gating or Lossy: copy up to out.size() elements into out and move the cursor past them,
+        // returns the number of elements copied
+        // - a Lossy consumer reads the elements while the producer may overwrite them, the copy is checked against
+        //   the producer afterwards and what was overwritten in the meantime is dropped and counted in lost()
+        std::size_t read(std::size_t consumer, std::span<T> out) noexcept
+            requires std::is_trivially_copyable_v<T>;
+
+        // consumer side: wait until something was published since the cursor of consumer, returns available()
+        std::size_t wait(std::size_t consumer) noexcept;
+
+        // consumer side: the elements consumer skipped because the producer overwrote them first (Lossy only)
+        std::size_t lost(std::size_t consumer) const noexcept { return m_cursors[consumer].m_lost; }
+
+        // the elements published that consumer hasn't consumed yet, may be more than capacity() for a Lossy one
+        std::size_t available(std::size_t consumer) const noexcept;
+
+        std::size_t capacity() const noexcept { return m_buffer.size(); }
+        std::size_t consumers() const noexcept { return m_consumers; }
+
+    private:
+        struct alignas(detail::cache_line_size) Cursor
+        {
+            std::atomic<std::size_t> m_sequence = 0;    // the next sequence to read
+            std::size_t              m_lost     = 0;
+            CursorPolicy             m_policy   = CursorPolicy::Gating;
+        };
+
+        static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
+
+        // producer side: the sequences it started to write and published, and its last seen gating sequence
+        alignas(detail::cache_line_size) std::atomic<std::size_t> m_claimed = 0;
+        std::atomic<std::size_t> m_published = 0;
+        std::size_t              m_gate      = 0;
+
+        // read-only after construction, sequences are free-running and masked on access
+        alignas(detail::cache_line_size) detail::RawBuffer<T> m_buffer;
+        std::unique_ptr<Cursor[]> m_cursors;
+        std::size_t               m_consumers = 0;
+        std::size_t               m_mask      = 0;
+
+        [[no_unique_address]] W m_wait;
+
+        // the sequence of the slowest Gating consumer, npos if there is none
+        std::size_t gate() const noexcept;
+
+        template <typename... Ts>
+        void publish(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>);
+    };
+}
+
+// -----------------------------------------------------------------------------
+// implementation detail
+// -----------------------------------------------------------------------------
+
+namespace circbuf
+{
+    template <ConcurrentElement T, WaitStrategy W>
+    BroadcastRing<T, W>::BroadcastRing(std::size_t capacity, std::span<const CursorPolicy> consumers)
+        : m_buffer{ capacity == 0 ? 0 : std::bit_ceil(capacity) }
+        , m_cursors{ std::make_unique<Cursor[]>(consumers.size()) }
+        , m_consumers{ consumers.size() }
+        , m_mask{ m_buffer.size() - 1 }
+    {
+        if (capacity == 0) {
+            throw error::ZeroCapacity{ "BroadcastRing can't be created with zero capacity" };
+        }
+
+        for (std::size_t i = 0; auto policy : consumers) {
+            if (policy == CursorPolicy::Lossy and not std::is_trivially_copyable_v<T>) {
+                throw error::InvalidPolicy{ "Lossy consumers of a BroadcastRing need a trivially copyable element" };
+            }
+            m_cursors[i++].m_policy = policy;
+        }
+        m_gate = gate();
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    BroadcastRing<T, W>::~BroadcastRing()
+    {
+        auto published = m_published.load(std::memory_order::relaxed);
+        auto count     = std::min(published, capacity());
+
+        for (auto sequence = published - count; sequence != published; ++sequence) {
+            m_buffer.destroy(sequence & m_mask);
+        }
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    template <typename... Ts>
+    bool BroadcastRing<T, W>::try_emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>)
+    {
+        auto sequence = m_published.load(std::memory_order::relaxed);
+
+        // only touch the consumer cache lines when the ring looks full
+        if (m_gate != npos and sequence - m_gate == capacity()) {
+            m_gate = gate();
+            if (sequence - m_gate == capacity()) {
+                return false;
+            }
+        }
+
+        publish(std::forward<Ts>(args)...);
+        return true;
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    template <typename... Ts>
+    void BroadcastRing<T, W>::emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>)
+    {
+        auto sequence = m_published.load(std::memory_order::relaxed);
+
+        // wait for every Gating consumer that is still capacity() elements behind, cursors only move forward
+        if (m_gate != npos and sequence - m_gate == capacity()) {
+            for (std::size_t i = 0; i < m_consumers; ++i) {
+                auto& cursor = m_cursors[i].m_sequence;
+                auto  room   = [&] { return sequence - cursor.load(std::memory_order::acquire) != capacity(); };
+                if (m_cursors[i].m_policy == CursorPolicy::Gating) {
+                    m_wait.wait(cursor, room);
+                }
+            }
+            m_gate = gate();
+        }
+
+        publish(std::forward<Ts>(args)...);
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    Segments<const T> BroadcastRing<T, W>::peek(std::size_t consumer) const noexcept
+    {
+        if (m_cursors[consumer].m_policy == CursorPolicy::Lossy) {
+            return {};
+        }
+
+        auto sequence  = m_cursors[consumer].m_sequence.load(std::memory_order::relaxed);
+        auto published = m_published.load(std::memory_order::acquire);
+
+        auto count = published - sequence;
+        auto start = sequence & m_mask;
+        auto split = std::min(count, capacity() - start);
+        return {
+            .first  = { m_buffer.data() + start, split },
+            .second = { m_buffer.data(), count - split },
+        };
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    void BroadcastRing<T, W>::consume(std::size_t consumer, std::size_t count)
+    {
+        if (m_cursors[consumer].m_policy == CursorPolicy::Lossy) {
+            throw error::InvalidPolicy{ "Lossy consumers of a BroadcastRing can only read" };
+        }
+
+        auto& cursor    = m_cursors[consumer].m_sequence;
+        auto  sequence  = cursor.load(std::memory_order::relaxed);
+        auto  published = m_published.load(std::memory_order::acquire);
+
+        if (count > published - sequence) {
+            throw error::OutOfRange{ "Cannot consume more than the elements published", count, published - sequence };
+        }
+
+        // release: the producer may overwrite the elements once it sees the new cursor
+        cursor.store(sequence + count, std::memory_order::release);
+        m_wait.notify(cursor);
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    std::size_t BroadcastRing<T, W>::read(std::size_t consumer, std::span<T> out) noexcept
+        requires std::is_trivially_copyable_v<T>
+    {
+        auto& cursor    = m_cursors[consumer];
+        auto  sequence  = cursor.m_sequence.load(std::memory_order::relaxed);
+        auto  published = m_published.load(std::memory_order::acquire);
+
+        // a Gating consumer is never lapped
+        if (published - sequence > capacity()) {
+            cursor.m_lost += published - sequence - capacity();
+            sequence       = published - capacity();
+        }
+
+        auto count = std::min(out.size(), published - sequence);
+        auto start = sequence & m_mask;
+        auto split = std::min(count, capacity() - start);
+
+        std::memcpy(out.data(), m_buffer.data() + start, split * sizeof(T));
+        std::memcpy(out.data() + split, m_buffer.data(), (count - split) * sizeof(T));
+
+        if (cursor.m_policy == CursorPolicy::Lossy) {
+            // the copies of the sequences the producer started to overwrite since are torn: drop them (seqlock)
+            std::atomic_thread_fence(std::memory_order::acquire);
+            auto claimed = m_claimed.load(std::memory_order::relaxed);
+            auto valid   = claimed > capacity() ? claimed - capacity() : 0;
+
+            if (valid > sequence) {
+                auto torn = std::min(valid - sequence, count);
+                std::memmove(out.data(), out.data() + torn, (count - torn) * sizeof(T));
+
+                cursor.m_lost += valid - sequence;
+                count         -= torn;
+                sequence       = valid;
+            }
+        }
+
+        cursor.m_sequence.store(sequence + count, std::memory_order::release);
+        if (cursor.m_policy == CursorPolicy::Gating) {
+            m_wait.notify(cursor.m_sequence);
+        }
+
+        return count;
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    std::size_t BroadcastRing<T, W>::wait(std::size_t consumer) noexcept
+    {
+        auto sequence = m_cursors[consumer].m_sequence.load(std::memory_order::relaxed);
+        m_wait.wait(m_published, [&] { return m_published.load(std::memory_order::acquire) != sequence; });
+
+        return available(consumer);
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    std::size_t BroadcastRing<T, W>::available(std::size_t consumer) const noexcept
+    {
+        // cursor first: published is only ever moving forward so the difference can't be negative
+        auto sequence  = m_cursors[consumer].m_sequence.load(std::memory_order::acquire);
+        auto published = m_published.load(std::memory_order::acquire);
+
+        return published - sequence;
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    std::size_t BroadcastRing<T, W>::gate() const noexcept
+    {
+        auto slowest = npos;
+        for (std::size_t i = 0; i < m_consumers; ++i) {
+            if (m_cursors[i].m_policy == CursorPolicy::Gating) {
+                slowest = std::min(slowest, m_cursors[i].m_sequence.load(std::memory_order::acquire));
+            }
+        }
+        return slowest;
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    template <typename... Ts>
+    void BroadcastRing<T, W>::publish(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>)
+    {
+        auto sequence = m_published.load(std::memory_order::relaxed);
+        auto index    = sequence & m_mask;
+
+        // the element is constructed before the slot is claimed if T may throw, the slot is left untouched then
+        auto write = [&](auto&&... values) {
+            // Lossy consumers must know that the slot is being written before any of its bytes change
+            m_claimed.store(sequence + 1, std::memory_order::relaxed);
+            std::atomic_thread_fence(std::memory_order::release);
+
+            if (sequence >= capacity()) {
+                m_buffer.destroy(index);
+            }
+            m_buffer.construct(index, std::forward<decltype(values)>(values)...);
+
+            m_published.store(sequence + 1, std::memory_order::release);
+            m_wait.notify(m_published);
+        };
+
+        if constexpr (std::is_nothrow_constructible_v<T, Ts...>) {
+            write(std::forward<Ts>(args)...);
+        } else {
+            auto value = T(std::forward<Ts>(args)...);
+            write(std::move(value));
+        }
+    }
+}
+
+#endif /* end of include guard: CIRCBUF_BROADCAST_RING_HPP */
@@ -1,17 +1,37 @@
 #ifndef CIRCBUF_CIRCBUF_HPP
 #define CIRCBUF_CIRCBUF_HPP
 
+#include "circbuf/detail/inline_buffer.hpp"
 #include "circbuf/detail/raw_buffer.hpp"
 #include "circbuf/error.hpp"
+#include "circbuf/relocatable.hpp"
 
 #include <algorithm>
+#include <bit>
 #include <concepts>
 #include <cstddef>
+#include <cstring>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <ranges>
 #include <span>
 #include <type_traits>
 #include <utility>
 
+// CircBuf::iterator is CircBuf::Iterator when this is 1: every dereference is bounds checked and may throw
+// error::OutOfRange. When this is 0 it is CircBuf::UncheckedIterator: a pointer into the underlying buffer that
+// wraps around, dereference is a single load and nothing is checked. Follows NDEBUG unless defined explicitly.
+#ifndef CIRCBUF_CHECKED_ITERATOR
+#    ifdef NDEBUG
+#        define CIRCBUF_CHECKED_ITERATOR 0
+#    else
+#        define CIRCBUF_CHECKED_ITERATOR 1
+#    endif
+#endif
+
 namespace circbuf
 {
     template <typename T>
@@ -23,7 +43,7 @@ namespace circbuf
         DiscardNew,
     };
 
-    // only apply when BufferCapacityPolicy == FixedCapacity and BufferStorePolicy == ReplaceOnFull
+    // only apply when BufferPolicy == ReplaceOnFull
     enum class BufferInsertPolicy
     {
         DiscardHead,    // discard the head element when the buffer is full
@@ -34,72 +54,401 @@ namespace circbuf
     {
         ReplaceOnFull,    // fixed capacity, push_back replace head, push_front replace tail
         ThrowOnFull,      // fixed capacity, throw on full
+        GrowOnFull,       // grow the capacity according to Growth on full, throw once it can't grow anymore
+    };
+
+    enum class BufferCapacityPolicy
+    {
+        Exact,         // capacity is exactly as requested, index wraps around by comparison
+        PowerOfTwo,    // capacity is rounded up to the next power of two, index wraps around by masking
+    };
+
+    // the elements of a CircBuf split into the two contiguous parts of the underlying buffer, in order:
+    // - first: from the head to the end of the underlying buffer (or to the tail if it doesn't wrap around)
+    // - second: from the start of the underlying buffer to the tail (empty if it doesn't wrap around)
+    template <typename T>
+    struct Segments
+    {
+        std::span<T> first;
+        std::span<T> second;
+
+        std::size_t size() const noexcept { return first.size() + second.size(); }
+        bool        empty() const noexcept { return size() == 0; }
+    };
+
+    // how a buffer with BufferPolicy::GrowOnFull grows when it is full: the capacity is multiplied by factor (but
+    // always grows by at least the number of elements pushed) up to max_capacity
+    // - a factor greater than 1 keeps the pushes amortized O(1)
+    // - with BufferCapacityPolicy::PowerOfTwo the capacity is rounded up as usual and max_capacity down
+    // and how it shrinks back after a burst (disabled when shrink_after is 0): once size() stayed below a quarter of
+    // the capacity for shrink_after pops in a row the capacity is halved, never below min_capacity; the gap between
+    // the two thresholds keeps a buffer that hovers around one of them from growing and shrinking over and over
+    struct Growth
+    {
+        double      factor       = 2.0;
+        std::size_t max_capacity = std::numeric_limits<std::size_t>::max();
+        std::size_t shrink_after = 0;
+        std::size_t min_capacity = 0;
+    };
+
+    // the memory a buffer gave back, automatically or through shrink_to_fit (see CircBuf::shrink_stats)
+    struct ShrinkStats
+    {
+        std::size_t shrinks         = 0;    // number of times the capacity decreased
+        std::size_t reclaimed_bytes = 0;    // released capacity times sizeof(T), before any storage rounding
+    };
+
+    // BufferPolicy stored in the CircBuf, can be changed at runtime through CircBuf::policy() (default)
+    struct RuntimePolicy
+    {
+        BufferPolicy m_value    = BufferPolicy::ReplaceOnFull;
+        Growth       m_growth   = {};
+        std::size_t  m_low_pops = 0;    // the pops in a row that left the buffer below the shrink threshold
+        ShrinkStats  m_stats    = {};
+
+        BufferPolicy get() const noexcept { return m_value; }
+        Growth       growth() const noexcept { return m_growth; }
+    };
+
+    // BufferPolicy fixed at compile time, takes no space and the branch on the policy is resolved at compile time
+    template <BufferPolicy P>
+    struct FixedPolicy
+    {
+        static constexpr BufferPolicy value = P;
+
+        constexpr BufferPolicy get() const noexcept { return P; }
+        constexpr Growth       growth() const noexcept { return {}; }
+    };
+
+    // only the Growth and the shrink state are stored
+    template <>
+    struct FixedPolicy<BufferPolicy::GrowOnFull>
+    {
+        static constexpr BufferPolicy value = BufferPolicy::GrowOnFull;
+
+        Growth      m_growth   = {};
+        std::size_t m_low_pops = 0;
+        ShrinkStats m_stats    = {};
+
+        constexpr BufferPolicy get() const noexcept { return value; }
+        constexpr Growth       growth() const noexcept { return m_growth; }
     };
 
-    template <CircBufElement T>
+    namespace detail
+    {
+        // storage which size is known at compile time (e.g. InlineBuffer)
+        template <typename S>
+        concept StaticStorage = requires { typename std::integral_constant<std::size_t, S::size()>; };
+
+        template <typename P>
+        concept FixedBufferPolicy = requires { typename std::integral_constant<BufferPolicy, P::value>; };
+
+        // policy which stores a Growth and the shrink state (RuntimePolicy and FixedPolicy<BufferPolicy::GrowOnFull>)
+        template <typename P>
+        concept GrowthPolicy = requires (P& policy) {
+            { policy.m_growth } -> std::same_as<Growth&>;
+        };
+
+        // storage which memory is mapped twice back to back (e.g. MirroredBuffer)
+        template <typename S>
+        concept MirroredStorage = requires { requires S::mirrored; };
+
+        // storage which can grow while keeping the elements at the same offsets (e.g. MappedBuffer)
+        template <typename S>
+        concept GrowableStorage = requires (S& storage, std::size_t size) { storage.grow(size); };
+
+        // storage which memory comes from an allocator (e.g. RawBuffer)
+        template <typename S>
+        concept AllocatorAwareStorage = requires { typename S::allocator_type; };
+
+        // CircBuf::allocator_type when the storage has no allocator
+        struct NoAllocator
+        {
+        };
+
+        // the allocator of a storage and its propagation traits, nothing to propagate when it has none
+        template <typename S>
+        struct StorageAllocator
+        {
+            using type = NoAllocator;
+
+            static constexpr bool propagate_on_copy = false;
+            static constexpr bool propagate_on_move = false;
+            static constexpr bool always_equal      = true;
+        };
+
+        template <AllocatorAwareStorage S>
+        struct StorageAllocator<S>
+        {
+            using type   = typename S::allocator_type;
+            using Traits = std::allocator_traits<type>;
+
+            static constexpr bool propagate_on_copy = Traits::propagate_on_container_copy_assignment::value;
+            static constexpr bool propagate_on_move = Traits::propagate_on_container_move_assignment::value;
+            static constexpr bool always_equal      = Traits::is_always_equal::value;
+        };
+    }
+
+    // Storage is the type of the underlying memory, it can be either detail::RawBuffer (from an allocator),
+    // detail::InlineBuffer (stored inside the CircBuf itself, see StaticCircBuf), detail::MirroredBuffer (mapped
+    // twice, see MirroredCircBuf) or detail::MappedBuffer (grows in place, see MappedCircBuf)
+    // Policy is either RuntimePolicy or FixedPolicy (see FixedPolicyCircBuf)
+    template <
+        CircBufElement T,
+        BufferCapacityPolicy C = BufferCapacityPolicy::Exact,
+        typename Storage       = detail::RawBuffer<T>,
+        typename Policy        = RuntimePolicy>
     class CircBuf
     {
     public:
         template <bool IsConst>
-        class [[nodiscard]] Iterator;    // random access iterator
+        class [[nodiscard]] Iterator;    // random access iterator, checked
+
+        template <bool IsConst>
+        class [[nodiscard]] UncheckedIterator;    // random access iterator, unchecked
 
         friend class Iterator<false>;
         friend class Iterator<true>;
+        friend class UncheckedIterator<false>;
+        friend class UncheckedIterator<true>;
 
         using Element = T;
 
         // STL compatibility/compliance [breaking my style, big sad...]
         using value_type      = Element;
-        using iterator        = Iterator<false>;
-        using const_iterator  = Iterator<true>;
+#if CIRCBUF_CHECKED_ITERATOR
+        using iterator       = Iterator<false>;
+        using const_iterator = Iterator<true>;
+#else
+        using iterator       = UncheckedIterator<false>;
+        using const_iterator = UncheckedIterator<true>;
+#endif
         using pointer         = T*;
         using const_pointer   = const T*;
         using reference       = T&;
         using const_reference = const T&;
         using size_type       = std::size_t;
+        using allocator_type  = typename detail::StorageAllocator<Storage>::type;
+
+        static constexpr BufferCapacityPolicy capacity_policy = C;
+        static constexpr bool                 static_capacity = detail::StaticStorage<Storage>;
+        static constexpr bool                 fixed_policy    = detail::FixedBufferPolicy<Policy>;
+        static constexpr bool                 mirrored        = detail::MirroredStorage<Storage>;
+        static constexpr bool                 allocator_aware = detail::AllocatorAwareStorage<Storage>;
 
         CircBuf() = default;
         ~CircBuf() { clear(); };
 
-        CircBuf(std::size_t capacity, BufferPolicy policy = BufferPolicy::ReplaceOnFull);
+        // with BufferCapacityPolicy::PowerOfTwo the capacity is rounded up to the next power of two
+        CircBuf(std::size_t capacity, BufferPolicy policy = BufferPolicy::ReplaceOnFull)
+            requires (not static_capacity and not fixed_policy);
+
+        CircBuf(std::size_t capacity)
+            requires (not static_capacity and fixed_policy);
+
+        // the capacity is fixed by the storage
+        explicit CircBuf(BufferPolicy policy)
+            requires (static_capacity and not fixed_policy);
+
+        // the memory comes from allocator (e.g. a std::pmr::memory_resource with pmr::CircBuf)
+        explicit CircBuf(const allocator_type& allocator) noexcept
+            requires (allocator_aware);
+
+        CircBuf(std::size_t capacity, const allocator_type& allocator)
+            requires (allocator_aware);
+
+        CircBuf(std::size_t capacity, BufferPolicy policy, const allocator_type& allocator)
+            requires (allocator_aware and not fixed_policy);
 
-        CircBuf(CircBuf&& other) noexcept;
-        CircBuf& operator=(CircBuf&& other) noexcept;
+        // BufferPolicy::GrowOnFull that grows according to growth, capacity may be zero: the first push allocates
+        CircBuf(std::size_t capacity, Growth growth)
+            requires (not static_capacity and detail::GrowthPolicy<Policy>);
 
+        CircBuf(std::size_t capacity, Growth growth, const allocator_type& allocator)
+            requires (allocator_aware and detail::GrowthPolicy<Policy>);
+
+        // moving a static capacity buffer moves each element instead of the storage, so does move assigning from a
+        // buffer which allocator doesn't propagate on move assignment and compares unequal
+        CircBuf(CircBuf&& other) noexcept(not static_capacity or std::is_nothrow_move_constructible_v<T>);
+        CircBuf& operator=(CircBuf&& other) noexcept(nothrow_move_assignable);
+
+        // the copy gets the allocator returned by select_on_container_copy_construction, copy assignment takes the
+        // allocator of other only if it propagates on copy assignment
         CircBuf(const CircBuf& other)
             requires std::copyable<T>;
         CircBuf& operator=(const CircBuf& other)
             requires std::copyable<T>;
 
-        BufferPolicy& policy() noexcept { return m_policy; }
+        // allocator-extended copy and move, the move takes the storage of other only if its allocator compares
+        // equal to allocator, otherwise the elements are moved one by one
+        CircBuf(const CircBuf& other, const allocator_type& allocator)
+            requires (allocator_aware and std::copyable<T>);
+        CircBuf(CircBuf&& other, const allocator_type& allocator)
+            requires (allocator_aware);
+
+        allocator_type get_allocator() const noexcept
+            requires (allocator_aware)
+        {
+            return m_buffer.get_allocator();
+        }
+
+        BufferPolicy& policy() noexcept
+            requires (not fixed_policy)
+        {
+            return m_policy.m_value;
+        }
+
+        BufferPolicy policy() const noexcept { return m_policy.get(); }
+
+        // only used with BufferPolicy::GrowOnFull
+        Growth& growth() noexcept
+            requires detail::GrowthPolicy<Policy>
+        {
+            return m_policy.m_growth;
+        }
+
+        Growth growth() const noexcept { return m_policy.growth(); }
+
+        ShrinkStats shrink_stats() const noexcept
+            requires detail::GrowthPolicy<Policy>
+        {
+            return m_policy.m_stats;
+        }
 
-        void swap(CircBuf& other) noexcept;
+        // the allocators are swapped only if they propagate on swap, otherwise they must compare equal
+        void swap(CircBuf& other) noexcept(not static_capacity or std::is_nothrow_move_constructible_v<T>);
         void clear() noexcept;
 
-        void resize(std::size_t new_capacity, BufferResizePolicy policy = BufferResizePolicy::DiscardOld);
+        // growing a MappedCircBuf remaps the memory in place instead of moving the elements into a new storage
+        void resize(std::size_t new_capacity, BufferResizePolicy policy = BufferResizePolicy::DiscardOld)
+            requires (not static_capacity);
+
+        // resize to size(), an empty buffer releases its storage (only GrowOnFull can push into it afterwards)
+        void shrink_to_fit()
+            requires (not static_capacity);
 
         T& insert(std::size_t pos, T&& value, BufferInsertPolicy policy = BufferInsertPolicy::DiscardHead);
         T  remove(std::size_t pos);
 
+        // insert the elements of the range before pos, the shorter side of pos is shifted once to make room
+        // - ThrowOnFull: throws if the range doesn't fit, nothing is inserted
+        // - GrowOnFull: grows once to fit the whole range, same as ThrowOnFull if it can't
+        // - ReplaceOnFull: the result is trimmed from the head or the tail (according to policy) to the capacity
+        template <std::ranges::input_range R>
+            requires (std::ranges::forward_range<R> or std::ranges::sized_range<R>)
+                 and std::constructible_from<T, std::ranges::range_reference_t<R>>
+        void insert_range(std::size_t pos, R&& range, BufferInsertPolicy policy = BufferInsertPolicy::DiscardHead);
+
+        // remove the elements in [first, last), the shorter side is shifted once to close the gap
+        void erase(std::size_t first, std::size_t last);
+
         T& push_front(const T& value);
         T& push_front(T&& value);
         T& push_back(const T& value);
         T& push_back(T&& value);
+
+        // with GrowOnFull and Growth::shrink_after the pops/removals may shrink the buffer, which invalidates the
+        // references to its elements just like a push that grows it
         T  pop_front();
         T  pop_back();
 
+        // construct the element in place from args, when the buffer is full (ReplaceOnFull) the element it replaces
+        // is destroyed first so args must not refer to it
+        template <typename... Ts>
+            requires std::constructible_from<T, Ts...>
+        T& emplace_front(Ts&&... args);
+
+        template <typename... Ts>
+            requires std::constructible_from<T, Ts...>
+        T& emplace_back(Ts&&... args);
+
+        // non-throwing counterparts of the functions above: instead of throwing, the push/insert functions return
+        // the error::Code of the exception that would have been thrown (error::Code::None on success), the
+        // pop/remove functions return std::nullopt and the element is not touched
+        // with GrowOnFull a failed allocation while growing is returned as error::Code::BufferFull too
+        [[nodiscard]] error::Code try_insert(
+            std::size_t        pos,
+            T&&                value,
+            BufferInsertPolicy policy = BufferInsertPolicy::DiscardHead
+        ) noexcept(std::is_nothrow_move_constructible_v<T> and std::is_nothrow_move_assignable_v<T>);
+
+        [[nodiscard]] error::Code try_push_front(const T& value) noexcept(
+            std::is_nothrow_copy_constructible_v<T> and std::is_nothrow_copy_assignable_v<T>
+        );
+        [[nodiscard]] error::Code try_push_front(T&& value) noexcept(
+            std::is_nothrow_move_constructible_v<T> and std::is_nothrow_move_assignable_v<T>
+        );
+        [[nodiscard]] error::Code try_push_back(const T& value) noexcept(
+            std::is_nothrow_copy_constructible_v<T> and std::is_nothrow_copy_assignable_v<T>
+        );
+        [[nodiscard]] error::Code try_push_back(T&& value) noexcept(
+            std::is_nothrow_move_constructible_v<T> and std::is_nothrow_move_assignable_v<T>
+        );
+
+        template <typename... Ts>
+            requires std::constructible_from<T, Ts...>
+        [[nodiscard]] error::Code try_emplace_front(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>);
+
+        template <typename... Ts>
+            requires std::constructible_from<T, Ts...>
+        [[nodiscard]] error::Code try_emplace_back(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>);
+
+        std::optional<T> try_remove(std::size_t pos) noexcept(
+            std::is_nothrow_move_constructible_v<T> and std::is_nothrow_move_assignable_v<T>
+        );
+        std::optional<T> try_pop_front() noexcept(std::is_nothrow_move_constructible_v<T>);
+        std::optional<T> try_pop_back() noexcept(std::is_nothrow_move_constructible_v<T>);
+
+        // push the whole range at once, the policy is checked once for the whole range:
+        // - ThrowOnFull: throws if the range doesn't fit, nothing is pushed
+        // - GrowOnFull: grows once to fit the whole range, same as ThrowOnFull if it can't
+        // - ReplaceOnFull: the oldest elements are discarded to make room, if the range is larger than the
+        //   capacity only the last capacity() elements of the range are kept
+        // ranges that are neither sized nor forward are pushed one element at a time
+        template <std::ranges::input_range R>
+            requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+        void push_back_range(R&& range);
+
+        // pop up to out.size() elements into out (move-assigned), returns the number of elements popped
+        std::size_t pop_front_n(std::span<T> out);
+
+        // producer side of the zero-copy API: up to count free slots after the tail as raw memory, write the elements
+        // into them then commit(n) appends the first n of them to the buffer; nothing is discarded so the spans may
+        // be shorter than count (empty when the buffer is full)
+        Segments<T> prepare(std::size_t count) noexcept
+            requires detail::ImplicitLifetime<T>;
+
+        void commit(std::size_t count)
+            requires detail::ImplicitLifetime<T>;
+
+        // consumer side of the zero-copy API: up to count elements from the head, consume(n) then destroys the first
+        // n of them
+        Segments<T>       peek(std::size_t count) noexcept;
+        Segments<const T> peek(std::size_t count) const noexcept;
+
+        void consume(std::size_t count);
+
+        // no-op with a mirrored storage
         CircBuf& linearize() noexcept;
 
+        [[nodiscard]] CircBuf linearize_copy() const noexcept
+            requires std::copyable<T>;
+
         // copied buffer will have the policy set to the parameter
         [[nodiscard]] CircBuf linearize_copy(BufferPolicy policy) const noexcept
-            requires std::copyable<T>;
+            requires std::copyable<T> and (not fixed_policy);
 
-        std::size_t size() const noexcept;
+        std::size_t size() const noexcept { return m_size; }
         std::size_t capacity() const noexcept { return m_buffer.size(); }
 
+        // with a mirrored storage the elements are always contiguous: never throws, the span starts at the head
         std::span<T>       data();
         std::span<const T> data() const;
 
+        // unlike data(), never throws and never moves anything regardless of the buffer state
+        Segments<T>       segments() noexcept;
+        Segments<const T> segments() const noexcept;
+
         auto&       at(std::size_t pos);
         const auto& at(std::size_t pos) const;
 
@@ -109,30 +458,153 @@ namespace circbuf
         auto&       back();
         const auto& back() const;
 
+        // nullptr instead of throwing when the element doesn't exist
+        T*       try_at(std::size_t pos) noexcept;
+        const T* try_at(std::size_t pos) const noexcept;
+
+        T*       try_front() noexcept { return try_at(0); }
+        const T* try_front() const noexcept { return try_at(0); }
+
+        T*       try_back() noexcept { return try_at(size() - 1); }    // size() - 1 wraps around when empty
+        const T* try_back() const noexcept { return try_at(size() - 1); }
+
         bool empty() const { return size() == 0; }
         bool full() const { return size() == capacity(); }
-        bool linearized() const { return m_head == 0; };
+        bool linearized() const { return mirrored or m_head == 0; };
 
-        auto begin() noexcept { return Iterator<false>(this, 0); }
-        auto begin() const noexcept { return Iterator<true>(this, 0); }
+        iterator       begin() noexcept { return { this, 0 }; }
+        const_iterator begin() const noexcept { return { this, 0 }; }
 
-        auto end() noexcept { return Iterator<false>(this, npos); }
-        auto end() const noexcept { return Iterator<true>(this, npos); }
+        iterator       end() noexcept { return { this, size() }; }
+        const_iterator end() const noexcept { return { this, size() }; }
 
-        Iterator<true> cbegin() const noexcept { return begin(); }
-        Iterator<true> cend() const noexcept { return begin(); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend() const noexcept { return end(); }
 
     private:
+        using StorageAllocator = detail::StorageAllocator<Storage>;
+
         static constexpr std::size_t npos = std::numeric_limits<std::size_t>::max();
 
-        detail::RawBuffer<T> m_buffer = {};
-        std::size_t          m_head   = 0;
-        std::size_t          m_tail   = npos;
-        BufferPolicy         m_policy = {};
+        static constexpr bool nothrow_move_assignable
+            = static_capacity ? std::is_nothrow_move_constructible_v<T>
+                              : StorageAllocator::propagate_on_move or StorageAllocator::always_equal;
+
+        Storage     m_buffer = {};
+        std::size_t m_head   = 0;
+        std::size_t m_size   = 0;
+
+        [[no_unique_address]] Policy m_policy = {};
+
+        static std::size_t round_capacity(std::size_t capacity) noexcept;
+
+        // a new storage for capacity elements, allocator is ignored when the storage has none
+        static Storage make_storage(std::size_t capacity, const allocator_type& allocator);
+
+        // the allocator of the storage and the one a copy of this buffer gets, allocator_type{} when it has none
+        allocator_type storage_allocator() const noexcept;
+        allocator_type copy_allocator() const noexcept;
+
+        // resize() to a bigger capacity with a growable storage, only the shorter wrapped part is relocated
+        void grow(std::size_t new_capacity);
+
+        // resize to a smaller capacity and count it in shrink_stats()
+        void shrink(std::size_t new_capacity);
+
+        // called after every pop/remove: halve the capacity according to growth() (BufferPolicy::GrowOnFull), an
+        // allocation failure is ignored and the buffer keeps its memory
+        void shrink_if_idle() noexcept;
+
+        // grow the capacity according to growth() so that count more elements fit (BufferPolicy::GrowOnFull),
+        // returns false and leaves the buffer untouched if that would exceed growth().max_capacity
+        // - try_make_room returns false instead of throwing when the allocation fails
+        bool make_room(std::size_t count);
+        bool try_make_room(std::size_t count) noexcept;
+
+        // push into a full buffer with BufferPolicy::GrowOnFull: the element is constructed from args before the
+        // buffer grows since args may refer to one of its elements, returns nullptr if it can't grow
+        // - Nothrow picks try_make_room instead of make_room
+        template <bool Nothrow, typename... Ts>
+        T* emplace_front_growing(Ts&&... args);
+        template <bool Nothrow, typename... Ts>
+        T* emplace_back_growing(Ts&&... args);
+
+        // the storage of other can be moved as a whole into this buffer, see operator=(CircBuf&&)
+        bool can_take_storage(const CircBuf& other) const noexcept;
 
-        std::size_t increment(std::size_t& index);
-        std::size_t decrement(std::size_t& index);
+        // the error a push into the buffer would run into, error::Code::None if there is none
+        error::Code push_error() const noexcept;
+
+        // the operations without their preconditions checked (see push_error)
+        T& insert_unchecked(std::size_t pos, T&& value, BufferInsertPolicy policy);
+        T  remove_unchecked(std::size_t pos);
+        T  pop_front_unchecked();
+        T  pop_back_unchecked();
+
+        template <typename U>
+        T& push_front_unchecked(U&& value);
+        template <typename U>
+        T& push_back_unchecked(U&& value);
+
+        template <typename... Ts>
+        T& emplace_front_unchecked(Ts&&... args);
+        template <typename... Ts>
+        T& emplace_back_unchecked(Ts&&... args);
+
+        // assign value to the element at the physical index, through a temporary if T is not assignable from U
+        template <typename U>
+        void assign(std::size_t index, U&& value);
+
+        // destroy count elements from the head
+        void destroy_front(std::size_t count) noexcept;
+
+        // move count elements starting at the physical index src by offset (negative: towards the head)
+        void shift(std::size_t src, std::size_t count, std::ptrdiff_t offset) noexcept(
+            std::is_nothrow_move_constructible_v<T>
+        );
+
+        // make room for count elements before pos, the slots of the gap are left unconstructed but are counted
+        // in size(), close_gap does the opposite
+        void open_gap(std::size_t pos, std::size_t count) noexcept(std::is_nothrow_move_constructible_v<T>);
+        void close_gap(std::size_t pos, std::size_t count) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+        // std::rotate the slots [0, last) of the storage so that the slot middle ends up first, the slots are swapped
+        // as raw bytes instead of through T if T is trivially relocatable
+        void rotate(std::size_t middle, std::size_t last) noexcept;
+
+        // take the elements of other, other is left empty but keeps its storage
+        void steal(CircBuf& other) noexcept(std::is_nothrow_move_constructible_v<T>);
+
+        // index must be less than 2 * capacity() for BufferCapacityPolicy::Exact
+        std::size_t wrap(std::size_t index) const noexcept;
+
+        std::size_t increment(std::size_t& index) const noexcept;
+        std::size_t decrement(std::size_t& index) const noexcept;
     };
+
+    // CircBuf with the elements stored inside the object itself, no allocation is made
+    template <
+        CircBufElement T,
+        std::size_t    N,
+        BufferCapacityPolicy C = std::has_single_bit(N) ? BufferCapacityPolicy::PowerOfTwo
+                                                         : BufferCapacityPolicy::Exact>
+    using StaticCircBuf = CircBuf<T, C, detail::InlineBuffer<T, N>>;
+
+    // CircBuf with the BufferPolicy fixed at compile time, e.g. FixedPolicyCircBuf<T, BufferPolicy::ReplaceOnFull>
+    // never throws error::BufferFull and has no branch on the policy when pushing into a full buffer
+    template <CircBufElement T, BufferPolicy P, BufferCapacityPolicy C = BufferCapacityPolicy::Exact>
+    using FixedPolicyCircBuf = CircBuf<T, C, detail::RawBuffer<T>, FixedPolicy<P>>;
+
+    // CircBuf which memory comes from Allocator, e.g. a memory pool or a NUMA-local arena
+    template <CircBufElement T, typename Allocator, BufferCapacityPolicy C = BufferCapacityPolicy::Exact>
+    using AllocatorCircBuf = CircBuf<T, C, detail::RawBuffer<T, Allocator>>;
+
+    namespace pmr
+    {
+        // CircBuf which memory comes from a std::pmr::memory_resource, e.g. a std::pmr::monotonic_buffer_resource
+        template <CircBufElement T, BufferCapacityPolicy C = BufferCapacityPolicy::Exact>
+        using CircBuf = circbuf::CircBuf<T, C, detail::RawBuffer<T, std::pmr::polymorphic_allocator<T>>>;
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -141,31 +613,103 @@ namespace circbuf
 
 namespace circbuf
 {
-    template <CircBufElement T>
-    CircBuf<T>::CircBuf(std::size_t capacity, BufferPolicy policy)
-        : m_buffer{ capacity }
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P>::CircBuf(std::size_t capacity, BufferPolicy policy)
+        requires (not static_capacity and not fixed_policy)
+        : m_buffer{ round_capacity(capacity) }
+        , m_head{ 0 }
+        , m_size{ 0 }
+        , m_policy{ policy }
+    {
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P>::CircBuf(std::size_t capacity)
+        requires (not static_capacity and fixed_policy)
+        : m_buffer{ round_capacity(capacity) }
+        , m_head{ 0 }
+        , m_size{ 0 }
+    {
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P>::CircBuf(BufferPolicy policy)
+        requires (static_capacity and not fixed_policy)
+        : m_head{ 0 }
+        , m_size{ 0 }
+        , m_policy{ policy }
+    {
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P>::CircBuf(const allocator_type& allocator) noexcept
+        requires (allocator_aware)
+        : m_buffer{ allocator }
+        , m_head{ 0 }
+        , m_size{ 0 }
+    {
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P>::CircBuf(std::size_t capacity, const allocator_type& allocator)
+        requires (allocator_aware)
+        : m_buffer{ round_capacity(capacity), allocator }
+        , m_head{ 0 }
+        , m_size{ 0 }
+    {
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P>::CircBuf(std::size_t capacity, BufferPolicy policy, const allocator_type& allocator)
+        requires (allocator_aware and not fixed_policy)
+        : m_buffer{ round_capacity(capacity), allocator }
         , m_head{ 0 }
-        , m_tail{ capacity == 0 ? npos : 0 }
+        , m_size{ 0 }
         , m_policy{ policy }
     {
     }
 
-    template <CircBufElement T>
-    CircBuf<T>::CircBuf(const CircBuf& other)
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P>::CircBuf(std::size_t capacity, Growth growth)
+        requires (not static_capacity and detail::GrowthPolicy<P>)
+        : m_buffer{ round_capacity(capacity) }
+        , m_head{ 0 }
+        , m_size{ 0 }
+    {
+        if constexpr (not fixed_policy) {
+            m_policy.m_value = BufferPolicy::GrowOnFull;
+        }
+        m_policy.m_growth = growth;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P>::CircBuf(std::size_t capacity, Growth growth, const allocator_type& allocator)
+        requires (allocator_aware and detail::GrowthPolicy<P>)
+        : m_buffer{ round_capacity(capacity), allocator }
+        , m_head{ 0 }
+        , m_size{ 0 }
+    {
+        if constexpr (not fixed_policy) {
+            m_policy.m_value = BufferPolicy::GrowOnFull;
+        }
+        m_policy.m_growth = growth;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P>::CircBuf(const CircBuf& other)
         requires std::copyable<T>
-        : m_buffer{ other.capacity() }
+        : m_buffer{ make_storage(other.capacity(), other.copy_allocator()) }
         , m_head{ 0 }
-        , m_tail{ other.full() ? npos : other.size() }
+        , m_size{ 0 }
         , m_policy{ other.m_policy }
     {
-        std::size_t pos = 0;
         for (const auto& copy : other) {
-            m_buffer.construct(pos++, T{ copy });    // copy performed here
+            m_buffer.construct(m_size++, T{ copy });    // copy performed here
         }
     }
 
-    template <CircBufElement T>
-    CircBuf<T>& CircBuf<T>::operator=(const CircBuf& other)
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P>& CircBuf<T, C, S, P>::operator=(const CircBuf& other)
         requires std::copyable<T>
     {
         if (this == &other) {
@@ -174,30 +718,71 @@ namespace circbuf
 
         clear();
 
-        m_buffer = detail::RawBuffer<T>{ other.capacity() };
-        m_head   = 0;
-        m_tail   = other.full() ? npos : other.size();
+        if constexpr (StorageAllocator::propagate_on_copy) {
+            m_buffer = make_storage(other.capacity(), other.storage_allocator());
+        } else if constexpr (not static_capacity) {
+            m_buffer = make_storage(other.capacity(), storage_allocator());
+        }
         m_policy = other.m_policy;
 
-        std::size_t pos = 0;
         for (const auto& copy : other) {
-            m_buffer.construct(pos++, T{ copy });    // copy performed here
+            m_buffer.construct(m_size++, T{ copy });    // copy performed here
         }
 
         return *this;
     }
 
-    template <CircBufElement T>
-    CircBuf<T>::CircBuf(CircBuf&& other) noexcept
-        : m_buffer{ std::exchange(other.m_buffer, {}) }
-        , m_head{ std::exchange(other.m_head, 0) }
-        , m_tail{ std::exchange(other.m_tail, npos) }
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P>::CircBuf(const CircBuf& other, const allocator_type& allocator)
+        requires (allocator_aware and std::copyable<T>)
+        : m_buffer{ make_storage(other.capacity(), allocator) }
+        , m_head{ 0 }
+        , m_size{ 0 }
+        , m_policy{ other.m_policy }
+    {
+        for (const auto& copy : other) {
+            m_buffer.construct(m_size++, T{ copy });    // copy performed here
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P>::CircBuf(CircBuf&& other) noexcept(
+        not static_capacity or std::is_nothrow_move_constructible_v<T>
+    )
+        : m_buffer{ make_storage(0, other.storage_allocator()) }
+        , m_head{ 0 }
+        , m_size{ 0 }
+        , m_policy{ std::exchange(other.m_policy, {}) }
+    {
+        if constexpr (static_capacity) {
+            steal(other);
+        } else {
+            m_buffer = std::move(other.m_buffer);    // other is left with an empty storage
+            m_head   = std::exchange(other.m_head, 0);
+            m_size   = std::exchange(other.m_size, 0);
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P>::CircBuf(CircBuf&& other, const allocator_type& allocator)
+        requires (allocator_aware)
+        : m_buffer{ allocator }
+        , m_head{ 0 }
+        , m_size{ 0 }
         , m_policy{ std::exchange(other.m_policy, {}) }
     {
+        if (allocator == other.get_allocator()) {
+            m_buffer = std::move(other.m_buffer);
+            m_head   = std::exchange(other.m_head, 0);
+            m_size   = std::exchange(other.m_size, 0);
+        } else {
+            m_buffer = make_storage(other.capacity(), allocator);
+            steal(other);
+        }
     }
 
-    template <CircBufElement T>
-    CircBuf<T>& CircBuf<T>::operator=(CircBuf&& other) noexcept
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P>& CircBuf<T, C, S, P>::operator=(CircBuf&& other) noexcept(nothrow_move_assignable)
     {
         if (this == &other) {
             return *this;
@@ -205,151 +790,135 @@ namespace circbuf
 
         clear();
 
-        m_buffer = std::exchange(other.m_buffer, {});
-        m_head   = std::exchange(other.m_head, 0);
-        m_tail   = std::exchange(other.m_tail, npos);
+        if constexpr (static_capacity) {
+            steal(other);
+        } else if (can_take_storage(other)) {
+            m_buffer = std::move(other.m_buffer);    // other is left with an empty storage
+            m_head   = std::exchange(other.m_head, 0);
+            m_size   = std::exchange(other.m_size, 0);
+        } else {
+            m_buffer = make_storage(other.capacity(), storage_allocator());
+            steal(other);
+        }
         m_policy = std::exchange(other.m_policy, {});
 
         return *this;
     }
 
-    template <CircBufElement T>
-    void CircBuf<T>::swap(CircBuf& other) noexcept
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    void CircBuf<T, C, S, P>::swap(CircBuf& other
+    ) noexcept(not static_capacity or std::is_nothrow_move_constructible_v<T>)
     {
-        std::swap(m_buffer, other.m_buffer);
-        std::swap(m_head, other.m_head);
-        std::swap(m_tail, other.m_tail);
-        std::swap(m_policy, other.m_policy);
+        if constexpr (static_capacity) {
+            auto temp = std::move(other);
+            other     = std::move(*this);
+            *this     = std::move(temp);
+        } else {
+            using std::swap;
+            swap(m_buffer, other.m_buffer);    // the storage takes care of its allocator
+            std::swap(m_head, other.m_head);
+            std::swap(m_size, other.m_size);
+            std::swap(m_policy, other.m_policy);
+        }
     }
 
-    template <CircBufElement T>
-    void CircBuf<T>::clear() noexcept
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    void CircBuf<T, C, S, P>::clear() noexcept
     {
         for (std::size_t i = 0; i < size(); ++i) {
-            m_buffer.destroy((m_head + i) % capacity());
+            m_buffer.destroy(wrap(m_head + i));
         }
 
         m_head = 0;
-        m_tail = 0;
+        m_size = 0;
     }
 
-    // TODO: add condition when
-    // - size < capacity && size < new_capacity
-    // - size < capacity && size > new_capacity
-    template <CircBufElement T>
-    void CircBuf<T>::resize(std::size_t new_capacity, BufferResizePolicy policy)
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    void CircBuf<T, C, S, P>::resize(std::size_t new_capacity, BufferResizePolicy policy)
+        requires (not static_capacity)
     {
-        if (new_capacity == 0) {
-            clear();
-            m_tail = npos;
-            return;
-        }
+        new_capacity = round_capacity(new_capacity);
 
         if (new_capacity == capacity()) {
             return;
         }
 
-        if (empty()) {
-            m_buffer = detail::RawBuffer<T>{ new_capacity };
-            m_head   = 0;
-            m_tail   = 0;
-
+        if (new_capacity == 0) {
+            clear();
+            m_buffer = make_storage(0, storage_allocator());
             return;
         }
 
-        if (new_capacity > capacity()) {
-            detail::RawBuffer<T> buffer{ new_capacity };
-            for (std::size_t i = 0; i < size(); ++i) {
-                auto idx = (m_head + i) % capacity();
-                buffer.construct(i, std::move(m_buffer.at(idx)));
-                m_buffer.destroy(idx);
+        if constexpr (detail::GrowableStorage<S>) {
+            if (new_capacity > capacity()) {
+                grow(new_capacity);
+                return;
             }
-
-            m_tail   = m_tail == npos ? capacity() : (m_tail + capacity() - m_head) % capacity();
-            m_buffer = std::move(buffer);
-            m_head   = 0;
-
-            return;
         }
 
-        auto buffer = detail::RawBuffer<T>{ new_capacity };
-        auto count  = size();
-        auto offset = count <= new_capacity ? 0ul : count - new_capacity;
+        auto buffer = make_storage(new_capacity, storage_allocator());
+        auto count  = std::min(size(), buffer.size());    // the storage may round the capacity up
+        auto offset = 0ul;
 
         switch (policy) {
-        case BufferResizePolicy::DiscardOld: {
-            auto begin = (m_head + offset) % capacity();
-            for (std::size_t i = 0; i < std::min(new_capacity, count); ++i) {
-                auto idx = (begin + i) % capacity();
-                buffer.construct(i, std::move(m_buffer.at(idx)));
-                m_buffer.destroy(idx);
-            }
-        } break;
-        case BufferResizePolicy::DiscardNew: {
-            auto end = m_tail == npos ? m_head : m_tail;
-            end      = (end + capacity() - offset) % capacity();
-            for (auto i = std::min(new_capacity, count); i-- > 0;) {
-                end = (end + capacity() - 1) % capacity();
-                buffer.construct(i, std::move(m_buffer.at(end)));
-                m_buffer.destroy(end);
-            }
-        } break;
+        case BufferResizePolicy::DiscardOld: offset = size() - count; break;
+        case BufferResizePolicy::DiscardNew: offset = 0; break;
         }
 
+        // the kept elements are relocated in at most two chunks (two std::memcpy if T is trivially relocatable),
+        // the discarded ones on either side are destroyed
+        destroy_front(offset);
+
+        auto split = std::min(count, capacity() - m_head);
+        buffer.relocate_n_from(0, m_buffer, m_head, split);
+        buffer.relocate_n_from(split, m_buffer, 0, count - split);
+        m_head  = wrap(m_head + count);
+        m_size -= count;
+
+        destroy_front(m_size);
+
         m_buffer = std::move(buffer);
         m_head   = 0;
-        m_tail   = count < new_capacity ? count : npos;
+        m_size   = count;
     }
 
-    template <CircBufElement T>
-    T& CircBuf<T>::insert(std::size_t pos, T&& value, BufferInsertPolicy policy)
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    void CircBuf<T, C, S, P>::shrink_to_fit()
+        requires (not static_capacity)
     {
-        if (capacity() == 0) {
-            throw error::ZeroCapacity{ "Can't push to a buffer with zero capacity" };
+        if (round_capacity(size()) < capacity()) {
+            shrink(size());
         }
+    }
 
-        if (m_tail == npos and m_policy == BufferPolicy::ThrowOnFull) {
-            throw error::BufferFull{ capacity() };
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    T& CircBuf<T, C, S, P>::insert(std::size_t pos, T&& value, BufferInsertPolicy policy)
+    {
+        if (capacity() == 0 and m_policy.get() != BufferPolicy::GrowOnFull) {
+            throw error::ZeroCapacity{ "Can't push to a buffer with zero capacity" };
         }
 
-        if (m_tail == npos) {
-            switch (policy) {
-            case BufferInsertPolicy::DiscardHead: pop_front(); break;
-            case BufferInsertPolicy::DiscardTail: pop_back(); break;
-            }
+        if (pos > size()) {
+            throw error::OutOfRange{ "Cannot insert at index greater than size", pos, size() };
         }
-        pos = (m_head + pos) % capacity();
-
-        // TODO: each element shifted towards the right, but it can be optimized to conditionally shift to the
-        // left or to the right depending on the position
 
-        auto current = m_tail;
-        T*   element = nullptr;
-
-        if (pos != m_tail) {
-            auto prev = current;
-            m_buffer.construct(current, std::move(m_buffer.at(decrement(prev))));
-            current = prev;
-
-            while (current != pos) {
-                auto prev            = current;
-                m_buffer.at(current) = std::move(m_buffer.at(decrement(prev)));
-                current              = prev;
-            }
-            element = &(m_buffer.at(current) = std::move(value));
-        } else {
-            element = &(m_buffer.construct(current, std::move(value)));
+        if (full() and m_policy.get() == BufferPolicy::ThrowOnFull) {
+            throw error::BufferFull{ capacity() };
         }
 
-        if (increment(m_tail) == m_head) {
-            m_tail = npos;
+        if (full() and m_policy.get() == BufferPolicy::GrowOnFull) {
+            auto element = T(std::move(value));    // value may refer to an element of the buffer
+            if (not make_room(1)) {
+                throw error::BufferFull{ capacity() };
+            }
+            return insert_unchecked(pos, std::move(element), policy);
         }
 
-        return *element;
+        return insert_unchecked(pos, std::move(value), policy);
     }
 
-    template <CircBufElement T>
-    T CircBuf<T>::remove(std::size_t pos)
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    T CircBuf<T, C, S, P>::remove(std::size_t pos)
     {
         if (empty()) {
             throw error::BufferEmpty{ capacity() };
@@ -359,241 +928,913 @@ namespace circbuf
             throw error::OutOfRange{ "Cannot remove at index greater than or equal to size", pos, size() };
         }
 
-        const auto count   = size() - pos - 1;
-        auto       realpos = (m_head + pos) % capacity();
-        auto       value   = std::move(m_buffer.at(realpos));
+        auto value = remove_unchecked(pos);
+        shrink_if_idle();
+        return value;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    error::Code CircBuf<T, C, S, P>::try_insert(std::size_t pos, T&& value, BufferInsertPolicy policy) noexcept(
+        std::is_nothrow_move_constructible_v<T> and std::is_nothrow_move_assignable_v<T>
+    )
+    {
+        // same order as insert so that both report the same error
+        if (capacity() == 0 and m_policy.get() != BufferPolicy::GrowOnFull) {
+            return error::Code::ZeroCapacity;
+        }
 
-        for (std::size_t i = 0; i < count; ++i) {
-            auto current         = (realpos + i) % capacity();
-            auto next            = (realpos + i + 1) % capacity();
-            m_buffer.at(current) = std::move(m_buffer.at(next));
+        if (pos > size()) {
+            return error::Code::OutOfRange;
         }
 
-        m_buffer.destroy((realpos + count) % capacity());
+        if (full() and m_policy.get() == BufferPolicy::ThrowOnFull) {
+            return error::Code::BufferFull;
+        }
 
-        if (m_tail == npos) {
-            m_tail = m_head;
+        if (full() and m_policy.get() == BufferPolicy::GrowOnFull) {
+            auto element = T(std::move(value));    // value may refer to an element of the buffer
+            if (not try_make_room(1)) {
+                return error::Code::BufferFull;
+            }
+            insert_unchecked(pos, std::move(element), policy);
+            return error::Code::None;
         }
-        decrement(m_tail);
 
-        return value;
+        insert_unchecked(pos, std::move(value), policy);
+        return error::Code::None;
     }
 
-    template <CircBufElement T>
-    T& CircBuf<T>::push_front(const T& value)
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    std::optional<T> CircBuf<T, C, S, P>::try_remove(std::size_t pos) noexcept(
+        std::is_nothrow_move_constructible_v<T> and std::is_nothrow_move_assignable_v<T>
+    )
     {
-        return push_front(T{ value });    // copy made here
+        if (pos >= size()) {
+            return std::nullopt;
+        }
+
+        auto value = std::optional<T>{ remove_unchecked(pos) };
+        shrink_if_idle();
+        return value;
     }
 
-    template <CircBufElement T>
-    T& CircBuf<T>::push_front(T&& value)
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    T& CircBuf<T, C, S, P>::insert_unchecked(std::size_t pos, T&& value, BufferInsertPolicy policy)
     {
-        if (capacity() == 0) {
-            throw error::ZeroCapacity{ "Can't push to a buffer with zero capacity" };
+        if (full()) {
+            switch (policy) {
+            case BufferInsertPolicy::DiscardHead: pop_front_unchecked(); break;
+            case BufferInsertPolicy::DiscardTail: pop_back_unchecked(); break;
+            }
+            pos = std::min(pos, size());
         }
 
-        if (m_tail == npos and m_policy == BufferPolicy::ThrowOnFull) {
-            throw error::BufferFull{ capacity() };
+        // shift whichever side of pos is shorter: the elements before pos towards the head or the elements after
+        // pos towards the tail, at most min(pos, size() - pos) elements are moved
+
+        if constexpr (TriviallyRelocatable<T> and std::is_nothrow_move_constructible_v<T>) {
+            // relocated in at most two chunks instead of a chain of move assignments
+            open_gap(pos, 1);
+            return m_buffer.construct(wrap(m_head + pos), std::move(value));
         }
 
-        auto current = m_head == 0 ? capacity() - 1 : m_head - 1;
+        T* element = nullptr;
 
-        if (m_tail != npos) {
-            m_buffer.construct(current, std::move(value));
-            m_head = current;
-            if (current == m_tail) {
-                m_tail = npos;
-            }
-        } else {
-            m_buffer.at(current) = std::move(value);
-            m_head               = current;
-        }
+        if (pos < m_size - pos) {
+            auto head    = wrap(m_head + capacity() - 1);
+            auto current = head;
+            auto next    = m_head;
 
-        return m_buffer.at(current);
-    }
+            if (pos != 0) {
+                m_buffer.construct(current, std::move(m_buffer.at(next)));
 
-    template <CircBufElement T>
-    T& CircBuf<T>::push_back(const T& value)
-    {
-        return push_back(T{ value });    // copy made here
-    };
+                for (std::size_t i = 1; i < pos; ++i) {
+                    current              = next;
+                    m_buffer.at(current) = std::move(m_buffer.at(increment(next)));
+                }
+                element = &(m_buffer.at(next) = std::move(value));
+            } else {
+                element = &(m_buffer.construct(current, std::move(value)));
+            }
 
-    template <CircBufElement T>
-    T& CircBuf<T>::push_back(T&& value)
-    {
-        if (capacity() == 0) {
-            throw error::ZeroCapacity{ "Can't push to a buffer with zero capacity" };
-        }
+            m_head = head;
+            ++m_size;
 
-        if (m_tail == npos and m_policy == BufferPolicy::ThrowOnFull) {
-            throw error::BufferFull{ capacity() };
+            return *element;
         }
 
-        auto current = m_head;
+        auto current = wrap(m_head + m_size);
 
-        // this branch only taken when the buffer is not full
-        if (m_tail != npos) {
-            current = m_tail;
-            m_buffer.construct(current, std::move(value));    // new entry -> construct
-            if (increment(m_tail) == m_head) {
-                m_tail = npos;
+        if (pos != m_size) {
+            auto prev = current;
+            m_buffer.construct(current, std::move(m_buffer.at(decrement(prev))));
+
+            for (auto i = m_size - 1; i > pos; --i) {
+                current              = prev;
+                m_buffer.at(current) = std::move(m_buffer.at(decrement(prev)));
             }
+            element = &(m_buffer.at(prev) = std::move(value));
         } else {
-            current              = m_head;
-            m_buffer.at(current) = std::move(value);    // already existing entry -> assign
-            increment(m_head);
+            element = &(m_buffer.construct(current, std::move(value)));
         }
 
-        return m_buffer.at(current);
+        ++m_size;
+
+        return *element;
     }
 
-    template <CircBufElement T>
-    T CircBuf<T>::pop_front()
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    T CircBuf<T, C, S, P>::remove_unchecked(std::size_t pos)
     {
-        if (empty()) {
-            throw error::BufferEmpty{ capacity() };
+        auto current = wrap(m_head + pos);
+        auto value   = std::move(m_buffer.at(current));
+
+        if constexpr (TriviallyRelocatable<T>) {
+            // relocated in at most two chunks instead of a chain of move assignments
+            m_buffer.destroy(current);
+            close_gap(pos, 1);
+            return value;
         }
 
-        auto value = std::move(m_buffer.at(m_head));
-        m_buffer.destroy(m_head);
-
-        if (m_tail == npos) {
-            m_tail = m_head;
-        }
-        increment(m_head);
+        // same as insert, the shorter side is shifted to fill the gap
+        if (pos < m_size - 1 - pos) {
+            for (auto i = pos; i > 0; --i) {
+                auto prev            = current;
+                m_buffer.at(current) = std::move(m_buffer.at(decrement(prev)));
+                current              = prev;
+            }
+
+            m_buffer.destroy(current);
+            increment(m_head);
+        } else {
+            for (auto i = pos + 1; i < m_size; ++i) {
+                auto next            = current;
+                m_buffer.at(current) = std::move(m_buffer.at(increment(next)));
+                current              = next;
+            }
+
+            m_buffer.destroy(current);
+        }
+
+        --m_size;
+
+        return value;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    template <std::ranges::input_range R>
+        requires (std::ranges::forward_range<R> or std::ranges::sized_range<R>)
+             and std::constructible_from<T, std::ranges::range_reference_t<R>>
+    void CircBuf<T, C, S, P>::insert_range(std::size_t pos, R&& range, BufferInsertPolicy policy)
+    {
+        auto count = static_cast<std::size_t>(std::ranges::distance(range));
+        if (count == 0) {
+            return;
+        }
+
+        if (capacity() == 0 and m_policy.get() != BufferPolicy::GrowOnFull) {
+            throw error::ZeroCapacity{ "Can't push to a buffer with zero capacity" };
+        }
+
+        if (pos > size()) {
+            throw error::OutOfRange{ "Cannot insert at index greater than size", pos, size() };
+        }
+
+        if (size() + count > capacity() and m_policy.get() == BufferPolicy::ThrowOnFull) {
+            throw error::BufferFull{ capacity() };
+        }
+
+        if (size() + count > capacity() and m_policy.get() == BufferPolicy::GrowOnFull and not make_room(count)) {
+            throw error::BufferFull{ capacity() };
+        }
+
+        auto first = std::ranges::begin(range);
+
+        // discard what wouldn't fit: the existing elements on the discarded side of pos go first, then the range
+        // itself, then the existing elements on the other side of pos
+        if (size() + count > capacity()) {
+            auto overflow = size() + count - capacity();
+
+            switch (policy) {
+            case BufferInsertPolicy::DiscardHead: {
+                auto old  = std::min(overflow, pos);
+                erase(0, old);
+                pos      -= old;
+                overflow -= old;
+
+                auto skip = std::min(overflow, count);
+                std::ranges::advance(first, static_cast<std::ranges::range_difference_t<R>>(skip));
+                count    -= skip;
+                overflow -= skip;
+
+                erase(pos, pos + overflow);
+            } break;
+            case BufferInsertPolicy::DiscardTail: {
+                auto old  = std::min(overflow, size() - pos);
+                erase(size() - old, size());
+                overflow -= old;
+
+                auto skip = std::min(overflow, count);
+                count    -= skip;
+                overflow -= skip;
+
+                erase(pos - overflow, pos);
+                pos -= overflow;
+            } break;
+            }
+
+            if (count == 0) {
+                return;
+            }
+        }
+
+        open_gap(pos, count);
+
+        auto start       = wrap(m_head + pos);
+        auto split       = std::min(count, capacity() - start);
+        auto constructed = std::size_t{ 0 };
+
+        try {
+            first       = m_buffer.construct_n(start, std::move(first), split);
+            constructed = split;
+            m_buffer.construct_n(0, std::move(first), count - split);
+        } catch (...) {
+            m_buffer.destroy_n(start, constructed);
+            close_gap(pos, count);
+            throw;
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    void CircBuf<T, C, S, P>::erase(std::size_t first, std::size_t last)
+    {
+        if (first > last or last > size()) {
+            throw error::OutOfRange{ "Cannot erase a range that is not within the buffer", last, size() };
+        }
+
+        auto count = last - first;
+        auto start = wrap(m_head + first);
+        auto split = std::min(count, capacity() - start);
+
+        m_buffer.destroy_n(start, split);
+        m_buffer.destroy_n(0, count - split);
+
+        close_gap(first, count);
+        shrink_if_idle();
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    T& CircBuf<T, C, S, P>::push_front(const T& value)
+    {
+        if (full() and m_policy.get() == BufferPolicy::GrowOnFull) {
+            if (auto* element = emplace_front_growing<false>(value)) {
+                return *element;
+            }
+            throw error::BufferFull{ capacity() };
+        }
+
+        if (capacity() == 0) {
+            throw error::ZeroCapacity{ "Can't push to a buffer with zero capacity" };
+        }
+
+        if (full() and m_policy.get() == BufferPolicy::ThrowOnFull) {
+            throw error::BufferFull{ capacity() };
+        }
+
+        return push_front_unchecked(value);
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    T& CircBuf<T, C, S, P>::push_front(T&& value)
+    {
+        if (full() and m_policy.get() == BufferPolicy::GrowOnFull) {
+            if (auto* element = emplace_front_growing<false>(std::move(value))) {
+                return *element;
+            }
+            throw error::BufferFull{ capacity() };
+        }
+
+        if (capacity() == 0) {
+            throw error::ZeroCapacity{ "Can't push to a buffer with zero capacity" };
+        }
+
+        if (full() and m_policy.get() == BufferPolicy::ThrowOnFull) {
+            throw error::BufferFull{ capacity() };
+        }
+
+        return push_front_unchecked(std::move(value));
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    error::Code CircBuf<T, C, S, P>::try_push_front(const T& value) noexcept(
+        std::is_nothrow_copy_constructible_v<T> and std::is_nothrow_copy_assignable_v<T>
+    )
+    {
+        if (full() and m_policy.get() == BufferPolicy::GrowOnFull) {
+            return emplace_front_growing<true>(value) ? error::Code::None : error::Code::BufferFull;
+        }
+
+        if (auto code = push_error(); code != error::Code::None) {
+            return code;
+        }
+
+        push_front_unchecked(value);
+        return error::Code::None;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    error::Code CircBuf<T, C, S, P>::try_push_front(T&& value) noexcept(
+        std::is_nothrow_move_constructible_v<T> and std::is_nothrow_move_assignable_v<T>
+    )
+    {
+        if (full() and m_policy.get() == BufferPolicy::GrowOnFull) {
+            return emplace_front_growing<true>(std::move(value)) ? error::Code::None : error::Code::BufferFull;
+        }
+
+        if (auto code = push_error(); code != error::Code::None) {
+            return code;
+        }
+
+        push_front_unchecked(std::move(value));
+        return error::Code::None;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    template <typename U>
+    T& CircBuf<T, C, S, P>::push_front_unchecked(U&& value)
+    {
+        auto current = m_head;
+        decrement(current);
+
+        if (not full()) {
+            m_buffer.construct(current, std::forward<U>(value));    // new entry -> construct
+            ++m_size;
+        } else {
+            assign(current, std::forward<U>(value));    // already existing entry (tail) -> assign
+        }
+        m_head = current;
+
+        return m_buffer.at(current);
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    template <typename... Ts>
+        requires std::constructible_from<T, Ts...>
+    T& CircBuf<T, C, S, P>::emplace_front(Ts&&... args)
+    {
+        if (full() and m_policy.get() == BufferPolicy::GrowOnFull) {
+            if (auto* element = emplace_front_growing<false>(std::forward<Ts>(args)...)) {
+                return *element;
+            }
+            throw error::BufferFull{ capacity() };
+        }
+
+        if (capacity() == 0) {
+            throw error::ZeroCapacity{ "Can't push to a buffer with zero capacity" };
+        }
+
+        if (full() and m_policy.get() == BufferPolicy::ThrowOnFull) {
+            throw error::BufferFull{ capacity() };
+        }
+
+        return emplace_front_unchecked(std::forward<Ts>(args)...);
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    template <typename... Ts>
+        requires std::constructible_from<T, Ts...>
+    error::Code CircBuf<T, C, S, P>::try_emplace_front(Ts&&... args) noexcept(
+        std::is_nothrow_constructible_v<T, Ts...>
+    )
+    {
+        if (full() and m_policy.get() == BufferPolicy::GrowOnFull) {
+            return emplace_front_growing<true>(std::forward<Ts>(args)...) ? error::Code::None : error::Code::BufferFull;
+        }
+
+        if (auto code = push_error(); code != error::Code::None) {
+            return code;
+        }
+
+        emplace_front_unchecked(std::forward<Ts>(args)...);
+        return error::Code::None;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    template <typename... Ts>
+    T& CircBuf<T, C, S, P>::emplace_front_unchecked(Ts&&... args)
+    {
+        // the tail is destroyed before the construction, if it throws the buffer is left one element shorter
+        if (full()) {
+            m_buffer.destroy(wrap(m_head + m_size - 1));
+            --m_size;
+        }
+
+        auto current = m_head;
+        decrement(current);
+
+        auto& element = m_buffer.construct(current, std::forward<Ts>(args)...);
+        m_head        = current;
+        ++m_size;
+
+        return element;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    T& CircBuf<T, C, S, P>::push_back(const T& value)
+    {
+        if (full() and m_policy.get() == BufferPolicy::GrowOnFull) {
+            if (auto* element = emplace_back_growing<false>(value)) {
+                return *element;
+            }
+            throw error::BufferFull{ capacity() };
+        }
+
+        if (capacity() == 0) {
+            throw error::ZeroCapacity{ "Can't push to a buffer with zero capacity" };
+        }
+
+        if (full() and m_policy.get() == BufferPolicy::ThrowOnFull) {
+            throw error::BufferFull{ capacity() };
+        }
+
+        return push_back_unchecked(value);
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    T& CircBuf<T, C, S, P>::push_back(T&& value)
+    {
+        if (full() and m_policy.get() == BufferPolicy::GrowOnFull) {
+            if (auto* element = emplace_back_growing<false>(std::move(value))) {
+                return *element;
+            }
+            throw error::BufferFull{ capacity() };
+        }
+
+        if (capacity() == 0) {
+            throw error::ZeroCapacity{ "Can't push to a buffer with zero capacity" };
+        }
+
+        if (full() and m_policy.get() == BufferPolicy::ThrowOnFull) {
+            throw error::BufferFull{ capacity() };
+        }
+
+        return push_back_unchecked(std::move(value));
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    error::Code CircBuf<T, C, S, P>::try_push_back(const T& value) noexcept(
+        std::is_nothrow_copy_constructible_v<T> and std::is_nothrow_copy_assignable_v<T>
+    )
+    {
+        if (full() and m_policy.get() == BufferPolicy::GrowOnFull) {
+            return emplace_back_growing<true>(value) ? error::Code::None : error::Code::BufferFull;
+        }
+
+        if (auto code = push_error(); code != error::Code::None) {
+            return code;
+        }
+
+        push_back_unchecked(value);
+        return error::Code::None;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    error::Code CircBuf<T, C, S, P>::try_push_back(T&& value) noexcept(
+        std::is_nothrow_move_constructible_v<T> and std::is_nothrow_move_assignable_v<T>
+    )
+    {
+        if (full() and m_policy.get() == BufferPolicy::GrowOnFull) {
+            return emplace_back_growing<true>(std::move(value)) ? error::Code::None : error::Code::BufferFull;
+        }
+
+        if (auto code = push_error(); code != error::Code::None) {
+            return code;
+        }
+
+        push_back_unchecked(std::move(value));
+        return error::Code::None;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    template <typename U>
+    T& CircBuf<T, C, S, P>::push_back_unchecked(U&& value)
+    {
+        auto current = m_head;
+
+        // this branch only taken when the buffer is not full
+        if (not full()) {
+            current = wrap(m_head + m_size);
+            m_buffer.construct(current, std::forward<U>(value));    // new entry -> construct
+            ++m_size;
+        } else {
+            assign(current, std::forward<U>(value));    // already existing entry (head) -> assign
+            increment(m_head);
+        }
+
+        return m_buffer.at(current);
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    template <typename... Ts>
+        requires std::constructible_from<T, Ts...>
+    T& CircBuf<T, C, S, P>::emplace_back(Ts&&... args)
+    {
+        if (full() and m_policy.get() == BufferPolicy::GrowOnFull) {
+            if (auto* element = emplace_back_growing<false>(std::forward<Ts>(args)...)) {
+                return *element;
+            }
+            throw error::BufferFull{ capacity() };
+        }
+
+        if (capacity() == 0) {
+            throw error::ZeroCapacity{ "Can't push to a buffer with zero capacity" };
+        }
+
+        if (full() and m_policy.get() == BufferPolicy::ThrowOnFull) {
+            throw error::BufferFull{ capacity() };
+        }
+
+        return emplace_back_unchecked(std::forward<Ts>(args)...);
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    template <typename... Ts>
+        requires std::constructible_from<T, Ts...>
+    error::Code CircBuf<T, C, S, P>::try_emplace_back(Ts&&... args) noexcept(
+        std::is_nothrow_constructible_v<T, Ts...>
+    )
+    {
+        if (full() and m_policy.get() == BufferPolicy::GrowOnFull) {
+            return emplace_back_growing<true>(std::forward<Ts>(args)...) ? error::Code::None : error::Code::BufferFull;
+        }
+
+        if (auto code = push_error(); code != error::Code::None) {
+            return code;
+        }
+
+        emplace_back_unchecked(std::forward<Ts>(args)...);
+        return error::Code::None;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    template <typename... Ts>
+    T& CircBuf<T, C, S, P>::emplace_back_unchecked(Ts&&... args)
+    {
+        // the head is destroyed before the construction, if it throws the buffer is left one element shorter
+        if (full()) {
+            destroy_front(1);
+        }
+
+        auto& element = m_buffer.construct(wrap(m_head + m_size), std::forward<Ts>(args)...);
+        ++m_size;
+
+        return element;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    T CircBuf<T, C, S, P>::pop_front()
+    {
+        if (empty()) {
+            throw error::BufferEmpty{ capacity() };
+        }
+
+        auto value = pop_front_unchecked();
+        shrink_if_idle();
+        return value;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    std::optional<T> CircBuf<T, C, S, P>::try_pop_front() noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (empty()) {
+            return std::nullopt;
+        }
+
+        auto value = std::optional<T>{ pop_front_unchecked() };
+        shrink_if_idle();
+        return value;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    T CircBuf<T, C, S, P>::pop_front_unchecked()
+    {
+        auto value = std::move(m_buffer.at(m_head));
+        m_buffer.destroy(m_head);
+
+        increment(m_head);
+        --m_size;
+
+        return value;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    T CircBuf<T, C, S, P>::pop_back()
+    {
+        if (empty()) {
+            throw error::BufferEmpty{ capacity() };
+        }
+
+        auto value = pop_back_unchecked();
+        shrink_if_idle();
+        return value;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    std::optional<T> CircBuf<T, C, S, P>::try_pop_back() noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (empty()) {
+            return std::nullopt;
+        }
+
+        auto value = std::optional<T>{ pop_back_unchecked() };
+        shrink_if_idle();
+        return value;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    T CircBuf<T, C, S, P>::pop_back_unchecked()
+    {
+        auto index = wrap(m_head + m_size - 1);
+        auto value = std::move(m_buffer.at(index));
+        m_buffer.destroy(index);
+
+        --m_size;
+
+        return value;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    template <std::ranges::input_range R>
+        requires std::constructible_from<T, std::ranges::range_reference_t<R>>
+    void CircBuf<T, C, S, P>::push_back_range(R&& range)
+    {
+        if constexpr (not std::ranges::sized_range<R> and not std::ranges::forward_range<R>) {
+            for (auto&& value : range) {
+                emplace_back(std::forward<decltype(value)>(value));
+            }
+        } else {
+            auto count = static_cast<std::size_t>(std::ranges::distance(range));
+            if (count == 0) {
+                return;
+            }
+
+            if (size() + count > capacity() and m_policy.get() == BufferPolicy::GrowOnFull and not make_room(count)) {
+                throw error::BufferFull{ capacity() };
+            }
+
+            if (capacity() == 0) {
+                throw error::ZeroCapacity{ "Can't push to a buffer with zero capacity" };
+            }
+
+            if (size() + count > capacity() and m_policy.get() == BufferPolicy::ThrowOnFull) {
+                throw error::BufferFull{ capacity() };
+            }
+
+            auto first = std::ranges::begin(range);
+
+            if (count >= capacity()) {
+                clear();
+                std::ranges::advance(first, static_cast<std::ranges::range_difference_t<R>>(count - capacity()));
+                count = capacity();
+            } else if (size() + count > capacity()) {
+                destroy_front(size() + count - capacity());
+            }
+
+            // at most two contiguous segments: [tail, end of buffer) then [0, ...)
+            auto tail  = wrap(m_head + m_size);
+            auto split = std::min(count, capacity() - tail);
+
+            first   = m_buffer.construct_n(tail, std::move(first), split);
+            m_size += split;
+            m_buffer.construct_n(0, std::move(first), count - split);
+            m_size += count - split;
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    std::size_t CircBuf<T, C, S, P>::pop_front_n(std::span<T> out)
+    {
+        auto count = std::min(out.size(), size());
+        auto split = std::min(count, capacity() - m_head);
+
+        auto move_out = [&](std::size_t offset, std::size_t n, T* dest) {
+            if constexpr (std::is_trivially_copyable_v<T>) {
+                if (n > 0) {
+                    std::memcpy(dest, m_buffer.data() + offset, n * sizeof(T));
+                }
+            } else {
+                std::move(m_buffer.data() + offset, m_buffer.data() + offset + n, dest);
+            }
+        };
+
+        move_out(m_head, split, out.data());
+        move_out(0, count - split, out.data() + split);
+        destroy_front(count);
+        shrink_if_idle();
+
+        return count;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    Segments<T> CircBuf<T, C, S, P>::prepare(std::size_t count) noexcept
+        requires detail::ImplicitLifetime<T>
+    {
+        count = std::min(count, capacity() - size());
+        if (count == 0) {
+            return {};
+        }
 
-        return value;
+        auto tail  = wrap(m_head + m_size);
+        auto split = mirrored ? count : std::min(count, capacity() - tail);
+        return {
+            .first  = { m_buffer.data() + tail, split },
+            .second = { m_buffer.data(), count - split },
+        };
     }
 
-    template <CircBufElement T>
-    T CircBuf<T>::pop_back()
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    void CircBuf<T, C, S, P>::commit(std::size_t count)
+        requires detail::ImplicitLifetime<T>
     {
-        if (empty()) {
-            throw error::BufferEmpty{ capacity() };
+        if (count > capacity() - size()) {
+            throw error::OutOfRange{ "Cannot commit more than the free slots", count, capacity() - size() };
         }
 
-        auto index = m_tail == npos ? (m_head == 0 ? capacity() - 1 : m_head - 1)
-                                    : (m_tail == 0 ? capacity() - 1 : m_tail - 1);
+        if (count == 0) {
+            return;
+        }
 
-        auto value = std::move(m_buffer.at(index));
-        m_buffer.destroy(index);
+        auto tail  = wrap(m_head + m_size);
+        auto split = std::min(count, capacity() - tail);
+        m_buffer.adopt_n(tail, split);
+        m_buffer.adopt_n(0, count - split);
 
-        m_tail = index;
+        m_size += count;
+    }
 
-        return value;
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    Segments<T> CircBuf<T, C, S, P>::peek(std::size_t count) noexcept
+    {
+        count      = std::min(count, size());
+        auto split = mirrored ? count : std::min(count, capacity() - m_head);
+        return {
+            .first  = { m_buffer.data() + m_head, split },
+            .second = { m_buffer.data(), count - split },
+        };
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    Segments<const T> CircBuf<T, C, S, P>::peek(std::size_t count) const noexcept
+    {
+        count      = std::min(count, size());
+        auto split = mirrored ? count : std::min(count, capacity() - m_head);
+        return {
+            .first  = { m_buffer.data() + m_head, split },
+            .second = { m_buffer.data(), count - split },
+        };
     }
 
-    template <CircBufElement T>
-    CircBuf<T>& CircBuf<T>::linearize() noexcept
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    void CircBuf<T, C, S, P>::consume(std::size_t count)
+    {
+        if (count > size()) {
+            throw error::OutOfRange{ "Cannot consume more than the elements in the buffer", count, size() };
+        }
+
+        if (count != 0) {
+            destroy_front(count);
+            shrink_if_idle();
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P>& CircBuf<T, C, S, P>::linearize() noexcept
     {
         if (linearized() or empty()) {
             return *this;
         }
 
         if (full()) {
-            std::rotate(m_buffer.data(), m_buffer.data() + m_head, m_buffer.data() + capacity());
+            rotate(m_head, capacity());
+            m_head = 0;
             return *this;
         }
 
-        auto prev_size = size();
+        // the relocations below are a single std::memmove each if T is trivially relocatable
 
-        if (m_head < m_tail or m_tail == 0)
+        if (m_head + m_size <= capacity())
         // - the initialized memory is contiguous, the uninitialized memory is split between them
         // - the uninitialized memory is at the beginning of the buffer
         {
             // we can go straight to moving the initialized memory to the beginning of the buffer
-            std::size_t start = 0;
-            std::size_t end   = m_tail == 0 ? capacity() : m_tail;
-            for (std::size_t i = m_head; i < end; ++i) {
-                m_buffer.construct(start++, std::move(m_buffer.at(i)));
-                m_buffer.destroy(i);
-            }
-
-            m_head = 0;
-            m_tail = prev_size;
+            m_buffer.relocate_n(0, m_head, m_size);
         } else
         // - the uninitialized memory is contiguous, the initialized memory is split between them
         {
-            // TODO: find out more efficient way to do this
-
-            // we need to move the uninitialized memory "hole" to the end of the buffer first
-            auto uninit_start = m_tail;
-            auto uninit_size  = capacity() - prev_size;
-
-            for (std::size_t i = m_head; i < capacity(); ++i) {
-                m_buffer.construct(uninit_start++, std::move(m_buffer.at(i)));
-                m_buffer.destroy(i);
+            auto tail  = m_head + m_size - capacity();    // size of the part at the start of the buffer
+            auto front = capacity() - m_head;             // size of the part at the end of the buffer
+
+            if (front <= m_head - tail) {
+                // the part at the end fits in the hole: make room for it at the start then move it there
+                m_buffer.relocate_n(front, 0, tail);
+                m_buffer.relocate_n(0, m_head, front);
+            } else {
+                // we need to move the uninitialized memory "hole" to the end of the buffer first
+                m_buffer.relocate_n(tail, m_head, front);
+                rotate(tail, m_size);
             }
-
-            std::rotate(m_buffer.data(), m_buffer.data() + m_head - uninit_size, m_buffer.data() + prev_size);
-
-            m_head = 0;
-            m_tail = prev_size;
         }
 
+        m_head = 0;
+
         return *this;
     }
 
-    template <CircBufElement T>
-    CircBuf<T> CircBuf<T>::linearize_copy(BufferPolicy policy) const noexcept
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P> CircBuf<T, C, S, P>::linearize_copy() const noexcept
         requires std::copyable<T>
     {
-        auto copy     = CircBuf{ *this };
-        copy.m_policy = policy;
-
-        return copy;
+        return CircBuf{ *this };    // the copy is always linearized
     }
 
-    template <CircBufElement T>
-    std::size_t CircBuf<T>::size() const noexcept
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    CircBuf<T, C, S, P> CircBuf<T, C, S, P>::linearize_copy(BufferPolicy policy) const noexcept
+        requires std::copyable<T> and (not fixed_policy)
     {
-        return capacity() == 0 ? 0
-             : m_tail == npos  ? capacity()
-                               : (m_tail + capacity() - m_head) % capacity();
+        auto copy             = CircBuf{ *this };
+        copy.m_policy.m_value = policy;
+
+        return copy;
     }
 
-    template <CircBufElement T>
-    std::span<T> CircBuf<T>::data()
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    std::span<T> CircBuf<T, C, S, P>::data()
     {
+        if constexpr (mirrored) {
+            return { m_buffer.data() + m_head, size() };
+        }
+
         if (not linearized() and not full()) {
             throw error::NotLinearizedNotFull{ "Reading the data will lead to undefined behavior" };
         }
         return { m_buffer.data(), size() };
     }
 
-    template <CircBufElement T>
-    std::span<const T> CircBuf<T>::data() const
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    std::span<const T> CircBuf<T, C, S, P>::data() const
     {
+        if constexpr (mirrored) {
+            return { m_buffer.data() + m_head, size() };
+        }
+
         if (not linearized() and not full()) {
             throw error::NotLinearizedNotFull{ "Reading the data will lead to undefined behavior" };
         }
         return { m_buffer.data(), size() };
     }
 
-    template <CircBufElement T>
-    auto& CircBuf<T>::at(std::size_t pos)
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    Segments<T> CircBuf<T, C, S, P>::segments() noexcept
+    {
+        auto split = mirrored ? m_size : std::min(m_size, capacity() - m_head);
+        return {
+            .first  = { m_buffer.data() + m_head, split },
+            .second = { m_buffer.data(), m_size - split },
+        };
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    Segments<const T> CircBuf<T, C, S, P>::segments() const noexcept
+    {
+        auto split = mirrored ? m_size : std::min(m_size, capacity() - m_head);
+        return {
+            .first  = { m_buffer.data() + m_head, split },
+            .second = { m_buffer.data(), m_size - split },
+        };
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    auto& CircBuf<T, C, S, P>::at(std::size_t pos)
     {
         if (pos >= size()) {
             throw error::OutOfRange{ "Can't access element outside of the range", pos, size() };
         }
 
-        auto realpos = (m_head + pos) % capacity();
-        return m_buffer.at(realpos);
+        return m_buffer.at(wrap(m_head + pos));
     }
 
-    template <CircBufElement T>
-    const auto& CircBuf<T>::at(std::size_t pos) const
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    const auto& CircBuf<T, C, S, P>::at(std::size_t pos) const
     {
         if (pos >= size()) {
             throw error::OutOfRange{ "Can't access element outside of the range", pos, size() };
         }
 
-        auto realpos = (m_head + pos) % capacity();
-        return m_buffer.at(realpos);
+        return m_buffer.at(wrap(m_head + pos));
     }
 
-    template <CircBufElement T>
-    auto& CircBuf<T>::front()
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    auto& CircBuf<T, C, S, P>::front()
     {
         if (empty()) {
             throw error::BufferEmpty{ capacity() };
@@ -601,8 +1842,8 @@ namespace circbuf
         return at(0);
     }
 
-    template <CircBufElement T>
-    const auto& CircBuf<T>::front() const
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    const auto& CircBuf<T, C, S, P>::front() const
     {
         if (empty()) {
             throw error::BufferEmpty{ capacity() };
@@ -610,8 +1851,8 @@ namespace circbuf
         return at(0);
     }
 
-    template <CircBufElement T>
-    auto& CircBuf<T>::back()
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    auto& CircBuf<T, C, S, P>::back()
     {
         if (empty()) {
             throw error::BufferEmpty{ capacity() };
@@ -619,8 +1860,8 @@ namespace circbuf
         return at(size() - 1);
     }
 
-    template <CircBufElement T>
-    const auto& CircBuf<T>::back() const
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    const auto& CircBuf<T, C, S, P>::back() const
     {
         if (empty()) {
             throw error::BufferEmpty{ capacity() };
@@ -628,27 +1869,360 @@ namespace circbuf
         return at(size() - 1);
     }
 
-    template <CircBufElement T>
-    std::size_t CircBuf<T>::increment(std::size_t& index)
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    T* CircBuf<T, C, S, P>::try_at(std::size_t pos) noexcept
+    {
+        return pos < size() ? &m_buffer.at(wrap(m_head + pos)) : nullptr;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    const T* CircBuf<T, C, S, P>::try_at(std::size_t pos) const noexcept
+    {
+        return pos < size() ? &m_buffer.at(wrap(m_head + pos)) : nullptr;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    error::Code CircBuf<T, C, S, P>::push_error() const noexcept
+    {
+        if (capacity() == 0) {
+            return error::Code::ZeroCapacity;
+        }
+
+        if (full() and m_policy.get() == BufferPolicy::ThrowOnFull) {
+            return error::Code::BufferFull;
+        }
+
+        return error::Code::None;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    std::size_t CircBuf<T, C, S, P>::round_capacity(std::size_t capacity) noexcept
+    {
+        if constexpr (C == BufferCapacityPolicy::PowerOfTwo) {
+            return capacity == 0 ? 0 : std::bit_ceil(capacity);
+        } else {
+            return capacity;
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    template <typename U>
+    void CircBuf<T, C, S, P>::assign(std::size_t index, U&& value)
+    {
+        if constexpr (std::is_assignable_v<T&, U&&>) {
+            m_buffer.at(index) = std::forward<U>(value);
+        } else {
+            m_buffer.at(index) = T(std::forward<U>(value));
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    void CircBuf<T, C, S, P>::destroy_front(std::size_t count) noexcept
+    {
+        auto split = std::min(count, capacity() - m_head);
+        m_buffer.destroy_n(m_head, split);
+        m_buffer.destroy_n(0, count - split);
+
+        m_head  = count == m_size ? 0 : wrap(m_head + count);
+        m_size -= count;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    void CircBuf<T, C, S, P>::shift(std::size_t src, std::size_t count, std::ptrdiff_t offset) noexcept(
+        std::is_nothrow_move_constructible_v<T>
+    )
+    {
+        // relocated in chunks that don't wrap around on either side, starting from the end the elements move to
+        // so that no element is overwritten before it is moved
+        auto distance = static_cast<std::size_t>(offset < 0 ? -offset : offset);
+
+        if (offset < 0) {
+            auto dst = wrap(src + capacity() - distance);
+            while (count > 0) {
+                auto n = std::min({ count, capacity() - src, capacity() - dst });
+                m_buffer.relocate_n(dst, src, n);
+                src    = wrap(src + n);
+                dst    = wrap(dst + n);
+                count -= n;
+            }
+        } else {
+            while (count > 0) {
+                auto src_end = wrap(src + count - 1) + 1;
+                auto dst_end = wrap(src + count - 1 + distance) + 1;
+                auto n       = std::min({ count, src_end, dst_end });
+                m_buffer.relocate_n(dst_end - n, src_end - n, n);
+                count -= n;
+            }
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    void CircBuf<T, C, S, P>::open_gap(std::size_t pos, std::size_t count) noexcept(
+        std::is_nothrow_move_constructible_v<T>
+    )
+    {
+        auto offset = static_cast<std::ptrdiff_t>(count);
+
+        if (pos < m_size - pos) {
+            shift(m_head, pos, -offset);
+            m_head = wrap(m_head + capacity() - count);
+        } else {
+            shift(wrap(m_head + pos), m_size - pos, offset);
+        }
+
+        m_size += count;
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    void CircBuf<T, C, S, P>::close_gap(std::size_t pos, std::size_t count) noexcept(
+        std::is_nothrow_move_constructible_v<T>
+    )
+    {
+        auto offset = static_cast<std::ptrdiff_t>(count);
+        auto after  = m_size - pos - count;
+
+        if (pos < after) {
+            shift(m_head, pos, offset);
+            m_head = wrap(m_head + count);
+        } else {
+            shift(wrap(m_head + pos + count), after, -offset);
+        }
+
+        m_size -= count;
+        if (m_size == 0) {
+            m_head = 0;
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    void CircBuf<T, C, S, P>::rotate(std::size_t middle, std::size_t last) noexcept
+    {
+        if constexpr (TriviallyRelocatable<T>) {
+            struct alignas(T) Slot
+            {
+                std::byte m_bytes[sizeof(T)];
+            };
+            auto* slots = reinterpret_cast<Slot*>(m_buffer.data());
+            std::rotate(slots, slots + middle, slots + last);
+        } else {
+            std::rotate(m_buffer.data(), m_buffer.data() + middle, m_buffer.data() + last);
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    void CircBuf<T, C, S, P>::steal(CircBuf& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        // keep the same layout as other so no index needs to be recomputed, the elements are relocated in at most
+        // two chunks (two std::memcpy if T is trivially relocatable)
+        auto split = std::min(other.m_size, other.capacity() - other.m_head);
+        m_buffer.relocate_n_from(other.m_head, other.m_buffer, other.m_head, split);
+        m_buffer.relocate_n_from(0, other.m_buffer, 0, other.m_size - split);
+
+        m_head = std::exchange(other.m_head, 0);
+        m_size = std::exchange(other.m_size, 0);
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    S CircBuf<T, C, S, P>::make_storage(std::size_t capacity, [[maybe_unused]] const allocator_type& allocator)
+    {
+        if constexpr (static_capacity) {
+            return S{};
+        } else if constexpr (allocator_aware) {
+            return S{ capacity, allocator };
+        } else {
+            return S{ capacity };
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    auto CircBuf<T, C, S, P>::storage_allocator() const noexcept -> allocator_type
+    {
+        if constexpr (allocator_aware) {
+            return m_buffer.get_allocator();
+        } else {
+            return {};
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    auto CircBuf<T, C, S, P>::copy_allocator() const noexcept -> allocator_type
+    {
+        if constexpr (allocator_aware) {
+            using Traits = typename StorageAllocator::Traits;
+            return Traits::select_on_container_copy_construction(m_buffer.get_allocator());
+        } else {
+            return {};
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    void CircBuf<T, C, S, P>::grow(std::size_t new_capacity)
+    {
+        auto old_capacity = capacity();
+        m_buffer.grow(new_capacity);
+
+        if (m_head + m_size <= old_capacity) {
+            return;
+        }
+
+        // the elements wrap around the old end: move either the part at the start after the old end (if it fits in
+        // the new slots) or the part at the old end to the new end, whichever is shorter
+        auto tail  = m_head + m_size - old_capacity;
+        auto front = old_capacity - m_head;
+
+        if (tail <= front and tail <= new_capacity - old_capacity) {
+            m_buffer.relocate_n(old_capacity, 0, tail);
+        } else {
+            m_buffer.relocate_n(new_capacity - front, m_head, front);
+            m_head = new_capacity - front;
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    void CircBuf<T, C, S, P>::shrink(std::size_t new_capacity)
+    {
+        if constexpr (not static_capacity) {
+            auto old_capacity = capacity();
+            resize(new_capacity);
+
+            if constexpr (detail::GrowthPolicy<P>) {
+                if (capacity() < old_capacity) {
+                    m_policy.m_stats.shrinks         += 1;
+                    m_policy.m_stats.reclaimed_bytes += (old_capacity - capacity()) * sizeof(T);
+                }
+            }
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    void CircBuf<T, C, S, P>::shrink_if_idle() noexcept
+    {
+        if constexpr (not static_capacity and detail::GrowthPolicy<P>) {
+            auto growth = m_policy.growth();
+            if (m_policy.get() != BufferPolicy::GrowOnFull or growth.shrink_after == 0) {
+                return;
+            }
+
+            if (size() >= capacity() / 4) {
+                m_policy.m_low_pops = 0;
+                return;
+            }
+
+            if (++m_policy.m_low_pops < growth.shrink_after) {
+                return;
+            }
+            m_policy.m_low_pops = 0;
+
+            auto new_capacity = std::max(capacity() / 2, growth.min_capacity);
+            if (round_capacity(new_capacity) >= capacity()) {
+                return;
+            }
+
+            try {
+                shrink(new_capacity);
+            } catch (...) {
+                // keep the current memory, shrinking is only an optimization
+            }
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    bool CircBuf<T, C, S, P>::make_room([[maybe_unused]] std::size_t count)
+    {
+        if constexpr (static_capacity) {
+            return false;
+        } else {
+            auto growth = m_policy.growth();
+            auto limit  = growth.max_capacity;
+            if constexpr (C == BufferCapacityPolicy::PowerOfTwo) {
+                limit = std::bit_floor(limit);    // so that rounding the new capacity up never exceeds it
+            }
+
+            if (count > limit or size() > limit - count) {
+                return false;
+            }
+
+            // the product is clamped as a double since it may not fit in std::size_t
+            auto scaled = static_cast<double>(capacity()) * growth.factor;
+            auto grown  = scaled < static_cast<double>(limit) ? static_cast<std::size_t>(scaled) : limit;
+
+            resize(std::max(size() + count, grown));
+            return true;
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    bool CircBuf<T, C, S, P>::try_make_room(std::size_t count) noexcept
+    {
+        try {
+            return make_room(count);
+        } catch (...) {
+            return false;
+        }
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    template <bool Nothrow, typename... Ts>
+    T* CircBuf<T, C, S, P>::emplace_front_growing(Ts&&... args)
+    {
+        auto element = T(std::forward<Ts>(args)...);
+        auto grown   = Nothrow ? try_make_room(1) : make_room(1);
+        if (not grown) {
+            return nullptr;
+        }
+        return &emplace_front_unchecked(std::move(element));
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    template <bool Nothrow, typename... Ts>
+    T* CircBuf<T, C, S, P>::emplace_back_growing(Ts&&... args)
+    {
+        auto element = T(std::forward<Ts>(args)...);
+        auto grown   = Nothrow ? try_make_room(1) : make_room(1);
+        if (not grown) {
+            return nullptr;
+        }
+        return &emplace_back_unchecked(std::move(element));
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    bool CircBuf<T, C, S, P>::can_take_storage([[maybe_unused]] const CircBuf& other) const noexcept
     {
-        if (++index == capacity()) {
-            index = 0;
+        if constexpr (StorageAllocator::propagate_on_move or StorageAllocator::always_equal) {
+            return true;
+        } else {
+            return m_buffer.get_allocator() == other.m_buffer.get_allocator();
         }
-        return index;
     }
 
-    template <CircBufElement T>
-    std::size_t CircBuf<T>::decrement(std::size_t& index)
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    std::size_t CircBuf<T, C, S, P>::wrap(std::size_t index) const noexcept
     {
-        if (index-- == 0) {
-            index = capacity() - 1;
+        if constexpr (C == BufferCapacityPolicy::PowerOfTwo) {
+            if constexpr (static_capacity) {
+                static_assert(std::has_single_bit(S::size()), "Static capacity must be a power of two");
+            }
+            return index & (capacity() - 1);
+        } else {
+            return index >= capacity() ? index - capacity() : index;
         }
-        return index;
     }
 
-    template <CircBufElement T>
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    std::size_t CircBuf<T, C, S, P>::increment(std::size_t& index) const noexcept
+    {
+        return index = wrap(index + 1);
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    std::size_t CircBuf<T, C, S, P>::decrement(std::size_t& index) const noexcept
+    {
+        return index = wrap(index + capacity() - 1);
+    }
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
     template <bool IsConst>
-    class CircBuf<T>::Iterator
+    class CircBuf<T, C, S, P>::Iterator
     {
     public:
         // STL compatibility/compliance [breaking my style, big sad...]
@@ -681,7 +2255,8 @@ namespace circbuf
         }
 
         // for const iterator construction from iterator
-        Iterator(Iterator<false>& other)
+        Iterator(const Iterator<false>& other) noexcept
+            requires IsConst
             : m_buffer{ other.m_buffer }
             , m_index{ other.m_index }
             , m_size{ other.m_size }
@@ -763,11 +2338,168 @@ namespace circbuf
             return static_cast<difference_type>(lpos) - static_cast<difference_type>(rpos);
         }
 
+        // segmented iterator protocol (see circbuf/algorithm.hpp): the elements in [first, last) as at most two
+        // contiguous segments of the underlying buffer
+        friend Segments<std::remove_pointer_t<pointer>> segments(const Iterator& first, const Iterator& last)
+        {
+            auto count = static_cast<std::size_t>(last - first);
+            if (count == 0) {
+                return {};
+            }
+
+            auto [head, tail] = first.m_buffer->segments();
+            if (first.m_index >= head.size()) {
+                return { .first = tail.subspan(first.m_index - head.size(), count), .second = {} };
+            }
+
+            auto split = std::min(count, head.size() - first.m_index);
+            return {
+                .first  = head.subspan(first.m_index, split),
+                .second = tail.first(count - split),
+            };
+        }
+
     private:
+        friend class Iterator<true>;
+
         BufferPtr   m_buffer = nullptr;
         std::size_t m_index  = CircBuf::npos;
         std::size_t m_size   = 0;
     };
+
+    template <CircBufElement T, BufferCapacityPolicy C, typename S, typename P>
+    template <bool IsConst>
+    class CircBuf<T, C, S, P>::UncheckedIterator
+    {
+    public:
+        // STL compatibility/compliance [breaking my style, big sad...]
+        using iterator          = UncheckedIterator<false>;
+        using const_iterator    = UncheckedIterator<true>;
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::conditional_t<IsConst, const value_type*, value_type*>;
+        using reference         = std::conditional_t<IsConst, const value_type&, value_type&>;
+
+        using BufferPtr = std::conditional_t<IsConst, const CircBuf*, CircBuf*>;
+
+        UncheckedIterator() noexcept                               = default;
+        UncheckedIterator(const UncheckedIterator&)                = default;
+        UncheckedIterator& operator=(const UncheckedIterator&)     = default;
+        UncheckedIterator(UncheckedIterator&&) noexcept            = default;
+        UncheckedIterator& operator=(UncheckedIterator&&) noexcept = default;
+
+        // index must be in [0, buffer->size()]
+        UncheckedIterator(BufferPtr buffer, std::size_t index) noexcept
+            : m_current{ buffer->m_buffer.data() + buffer->wrap(buffer->m_head + index) }
+            , m_begin{ buffer->m_buffer.data() }
+            , m_end{ buffer->m_buffer.data() + buffer->capacity() }
+            , m_index{ static_cast<difference_type>(index) }
+        {
+        }
+
+        // for const iterator construction from iterator
+        UncheckedIterator(const UncheckedIterator<false>& other) noexcept
+            requires IsConst
+            : m_current{ other.m_current }
+            , m_begin{ other.m_begin }
+            , m_end{ other.m_end }
+            , m_index{ other.m_index }
+        {
+        }
+
+        // the pointer is not enough to tell begin and end apart on a full buffer, the logical index is compared
+        auto operator<=>(const UncheckedIterator& other) const noexcept { return m_index <=> other.m_index; }
+        bool operator==(const UncheckedIterator& other) const noexcept { return m_index == other.m_index; }
+
+        UncheckedIterator& operator+=(difference_type n) noexcept
+        {
+            // n is within [-capacity, capacity] so one correction is enough
+            auto offset = (m_current - m_begin) + n;
+            if (offset >= m_end - m_begin) {
+                offset -= m_end - m_begin;
+            } else if (offset < 0) {
+                offset += m_end - m_begin;
+            }
+
+            m_current  = m_begin + offset;
+            m_index   += n;
+
+            return *this;
+        }
+
+        UncheckedIterator& operator-=(difference_type n) noexcept { return (*this) += -n; }
+
+        UncheckedIterator& operator++() noexcept
+        {
+            if (++m_current == m_end) {
+                m_current = m_begin;
+            }
+            ++m_index;
+            return *this;
+        }
+
+        UncheckedIterator& operator--() noexcept
+        {
+            if (m_current == m_begin) {
+                m_current = m_end;
+            }
+            --m_current;
+            --m_index;
+            return *this;
+        }
+
+        UncheckedIterator operator++(int) noexcept
+        {
+            auto copy = *this;
+            ++(*this);
+            return copy;
+        }
+
+        UncheckedIterator operator--(int) noexcept
+        {
+            auto copy = *this;
+            --(*this);
+            return copy;
+        }
+
+        reference operator*() const noexcept { return *m_current; }
+        pointer   operator->() const noexcept { return m_current; }
+
+        reference operator[](difference_type n) const noexcept { return *(*this + n); }
+
+        friend UncheckedIterator operator+(UncheckedIterator lhs, difference_type n) noexcept { return lhs += n; }
+        friend UncheckedIterator operator+(difference_type n, UncheckedIterator rhs) noexcept { return rhs += n; }
+        friend UncheckedIterator operator-(UncheckedIterator lhs, difference_type n) noexcept { return lhs -= n; }
+
+        friend difference_type operator-(const UncheckedIterator& lhs, const UncheckedIterator& rhs) noexcept
+        {
+            return lhs.m_index - rhs.m_index;
+        }
+
+        // segmented iterator protocol (see circbuf/algorithm.hpp)
+        friend Segments<std::remove_pointer_t<pointer>> segments(
+            const UncheckedIterator& first,
+            const UncheckedIterator& last
+        )
+        {
+            auto count = static_cast<std::size_t>(last - first);
+            auto split = std::min(count, static_cast<std::size_t>(first.m_end - first.m_current));
+
+            return {
+                .first  = { first.m_current, split },
+                .second = { first.m_begin, count - split },
+            };
+        }
+
+    private:
+        friend class UncheckedIterator<true>;
+
+        pointer         m_current = nullptr;
+        pointer         m_begin   = nullptr;    // start of the underlying buffer
+        pointer         m_end     = nullptr;    // end of the underlying buffer, where m_current wraps around
+        difference_type m_index   = 0;          // position from the head, for comparison and distance
+    };
 }
 
 #endif /* end of include guard: CIRCBUF_CIRCBUF_HPP */
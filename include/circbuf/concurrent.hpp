@@ -0,0 +1,162 @@
+#ifndef CIRCBUF_CONCURRENT_HPP
+#define CIRCBUF_CONCURRENT_HPP
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace circbuf
+{
+    // elements of the concurrent queues must not throw on move and destruction so that push and pop never throw
+    template <typename T>
+    concept ConcurrentElement = std::is_nothrow_move_constructible_v<T> and std::is_nothrow_destructible_v<T>;
+}
+
+namespace circbuf::detail
+{
+    // the pause hint of spin-wait loops: lets the sibling hyper-thread run and saves power, no-op elsewhere
+    inline void cpu_relax() noexcept
+    {
+#if defined(__x86_64__) or defined(__i386__)
+        __builtin_ia32_pause();
+#elif defined(__aarch64__)
+        asm volatile("yield");
+#endif
+    }
+
+    // waiting in the blocking functions of the concurrent queues: spin a few times first since the other side is
+    // usually about to finish, then yield the thread so that an oversubscribed machine still makes progress
+    class Backoff
+    {
+    public:
+        static constexpr std::size_t spin_limit = 64;
+
+        void operator()() noexcept
+        {
+            if (m_count < spin_limit) {
+                ++m_count;
+                cpu_relax();
+            } else {
+                std::this_thread::yield();
+            }
+        }
+
+    private:
+        std::size_t m_count = 0;
+    };
+
+    inline constexpr std::size_t park_slots = 64;
+
+    // the parked counter of ParkWait used for word: the neighbouring words of a queue (the sequences of MpmcQueue,
+    // the cursors of BroadcastRing) are spread over the slots by a multiplicative hash of their address
+    inline std::size_t park_slot(const void* word) noexcept
+    {
+        static_assert(std::has_single_bit(park_slots));
+
+        auto address = static_cast<std::uint64_t>(reinterpret_cast<std::uintptr_t>(word));
+        return static_cast<std::size_t>((address * 0x9E3779B97F4A7C15ull) >> (64 - std::countr_zero(park_slots)));
+    }
+}
+
+namespace circbuf
+{
+    // how the blocking functions of the concurrent queues wait for the other side, selected per queue
+    // - wait(word, ready) returns once ready() is true, word is the atomic whose change may make it so
+    // - notify(word) is called after every change of word that may make a waiter ready
+    template <typename W>
+    concept WaitStrategy = std::default_initializable<W>
+                       and requires (W& strategy, std::atomic<std::size_t>& word, bool (&ready)()) {
+                               strategy.wait(std::as_const(word), ready);
+                               strategy.notify(word);
+                           };
+
+    // busy-spin with the pause hint: the lowest latency, but burns a core per waiting thread
+    struct SpinWait
+    {
+        template <std::predicate Ready>
+        void wait(const std::atomic<std::size_t>&, Ready ready) noexcept
+        {
+            while (not ready()) {
+                detail::cpu_relax();
+            }
+        }
+
+        void notify(std::atomic<std::size_t>&) noexcept { }
+    };
+
+    // spin a few times then yield the thread (the default): still polls, but gives the core away when oversubscribed
+    struct YieldWait
+    {
+        template <std::predicate Ready>
+        void wait(const std::atomic<std::size_t>&, Ready ready) noexcept
+        {
+            auto backoff = detail::Backoff{};
+            while (not ready()) {
+                backoff();
+            }
+        }
+
+        void notify(std::atomic<std::size_t>&) noexcept { }
+    };
+
+    // spin a few times then sleep in std::atomic::wait (a futex on Linux) until notified: no CPU used while parked
+    // - the parked threads are counted per waited-on word (hashed into park_slots counters), so the notifying side
+    //   only makes the wake syscall when a thread is parked on that word (or on one sharing its slot), the price of
+    //   checking is a full fence on every notify
+    class ParkWait
+    {
+    public:
+        template <std::predicate Ready>
+        void wait(const std::atomic<std::size_t>& word, Ready ready) noexcept
+        {
+            for (std::size_t i = 0; i < detail::Backoff::spin_limit; ++i) {
+                if (ready()) {
+                    return;
+                }
+                detail::cpu_relax();
+            }
+
+            auto& parked = m_parked[detail::park_slot(&word)];
+
+            // announce the park before the last look at word, pairs with the fence in notify: either the notifier
+            // sees parked or we see its change of word
+            while (true) {
+                parked.fetch_add(1, std::memory_order::seq_cst);
+                auto value = word.load(std::memory_order::seq_cst);
+
+                if (not ready()) {
+                    word.wait(value, std::memory_order::relaxed);
+                }
+                parked.fetch_sub(1, std::memory_order::relaxed);
+
+                if (ready()) {
+                    return;
+                }
+            }
+        }
+
+        void notify(std::atomic<std::size_t>& word) noexcept
+        {
+            std::atomic_thread_fence(std::memory_order::seq_cst);
+            if (m_parked[detail::park_slot(&word)].load(std::memory_order::relaxed) > 0) {
+                m_wakes.fetch_add(1, std::memory_order::relaxed);
+                word.notify_all();
+            }
+        }
+
+        // the number of notify calls that made the wake syscall
+        std::size_t wakes() const noexcept { return m_wakes.load(std::memory_order::relaxed); }
+
+    private:
+        std::array<std::atomic<std::size_t>, detail::park_slots> m_parked = {};
+        std::atomic<std::size_t>                                  m_wakes  = 0;
+    };
+}
+
+#endif /* end of include guard: CIRCBUF_CONCURRENT_HPP */
@@ -0,0 +1,13 @@
+#ifndef CIRCBUF_CACHE_LINE_HPP
+#define CIRCBUF_CACHE_LINE_HPP
+
+#include <cstddef>
+
+namespace circbuf::detail
+{
+    // std::hardware_destructive_interference_size is not stable across compiler flags (gcc warns about it
+    // when used in a header), so we hardcode the common value for x86-64 and aarch64 instead
+    inline constexpr std::size_t cache_line_size = 64;
+}
+
+#endif /* end of include guard: CIRCBUF_CACHE_LINE_HPP */
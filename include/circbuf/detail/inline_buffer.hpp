@@ -0,0 +1,86 @@
+#ifndef CIRCBUF_INLINE_BUFFER_HPP
+#define CIRCBUF_INLINE_BUFFER_HPP
+
+#include "circbuf/detail/storage.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace circbuf::detail
+{
+    // same as RawBuffer but the memory lives inside the object itself and the size is a compile-time constant
+    template <typename T, std::size_t N>
+    class InlineBuffer
+    {
+    public:
+        static_assert(N > 0, "InlineBuffer must have non-zero size");
+
+        InlineBuffer() noexcept { }    // leave the memory uninitialized
+        ~InlineBuffer() { m_constructed.assert_destroyed(); }
+
+        // the elements lifetime is managed by the owner, it is the one who should move them
+        InlineBuffer(InlineBuffer&&)                 = delete;
+        InlineBuffer& operator=(InlineBuffer&&)      = delete;
+        InlineBuffer(const InlineBuffer&)            = delete;
+        InlineBuffer& operator=(const InlineBuffer&) = delete;
+
+        // the element functions, see Elements
+        template <typename... Ts>
+        T& construct(std::size_t offset, Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>)
+        {
+            return elements().construct(offset, std::forward<Ts>(args)...);
+        }
+
+        void destroy(std::size_t offset) noexcept { elements().destroy(offset); }
+
+        template <std::input_iterator It>
+        It construct_n(std::size_t offset, It first, std::size_t count)
+        {
+            return elements().construct_n(offset, std::move(first), count);
+        }
+
+        void destroy_n(std::size_t offset, std::size_t count) noexcept { elements().destroy_n(offset, count); }
+
+        void adopt_n(std::size_t offset, std::size_t count) noexcept
+            requires ImplicitLifetime<T>
+        {
+            elements().adopt_n(offset, count);
+        }
+
+        void relocate_n(std::size_t dst, std::size_t src, std::size_t count) noexcept(
+            std::is_nothrow_move_constructible_v<T>
+        )
+        {
+            elements().relocate_n(dst, src, count);
+        }
+
+        void relocate_n_from(std::size_t dst, InlineBuffer& other, std::size_t src, std::size_t count) noexcept(
+            std::is_nothrow_move_constructible_v<T>
+        )
+        {
+            elements().relocate_n_from(dst, other.elements(), src, count);
+        }
+
+        T*       data() noexcept { return reinterpret_cast<T*>(m_storage); }
+        const T* data() const noexcept { return reinterpret_cast<const T*>(m_storage); }
+
+        auto&        at(std::size_t pos) & noexcept { return data()[pos]; }
+        auto&&       at(std::size_t pos) && noexcept { return data()[pos]; }
+        const auto&  at(std::size_t pos) const& noexcept { return std::as_const(data()[pos]); }
+        const auto&& at(std::size_t pos) const&& noexcept { return std::as_const(data()[pos]); }
+
+        static constexpr std::size_t size() noexcept { return N; }
+
+    private:
+        alignas(T) std::byte m_storage[sizeof(T) * N];
+
+        [[no_unique_address]] ConstructedFlags<N> m_constructed = {};
+
+        Elements<T, std::allocator<T>, N> elements() noexcept { return { {}, data(), m_constructed }; }
+    };
+}
+
+#endif /* end of include guard: CIRCBUF_INLINE_BUFFER_HPP */
@@ -0,0 +1,217 @@
+#ifndef CIRCBUF_MAPPED_BUFFER_HPP
+#define CIRCBUF_MAPPED_BUFFER_HPP
+
+#include "circbuf/detail/storage.hpp"
+#include "circbuf/relocatable.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <system_error>
+#include <utility>
+
+namespace circbuf::detail
+{
+    // same as RawBuffer but the memory is an anonymous mapping (Linux only) that can grow in place with mremap:
+    // the pages are remapped instead of copied and the old and new memory never coexist
+    // - only trivially relocatable elements are allowed since the mapping may move to another address
+    // - the mapping is rounded up to whole pages, size() is exactly the requested size
+    template <typename T>
+    class MappedBuffer
+    {
+    public:
+        static_assert(TriviallyRelocatable<T>, "MappedBuffer elements must be trivially relocatable");
+
+        MappedBuffer() = default;
+
+        // throws std::system_error when the memory can't be mapped
+        explicit MappedBuffer(std::size_t size);
+        ~MappedBuffer();
+
+        MappedBuffer(MappedBuffer&& other) noexcept;
+        MappedBuffer& operator=(MappedBuffer&& other) noexcept;
+
+        MappedBuffer(const MappedBuffer&)            = delete;
+        MappedBuffer& operator=(const MappedBuffer&) = delete;
+
+        // the element functions, see Elements
+        template <typename... Ts>
+        T& construct(std::size_t offset, Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>)
+        {
+            return elements().construct(offset, std::forward<Ts>(args)...);
+        }
+
+        void destroy(std::size_t offset) noexcept { elements().destroy(offset); }
+
+        template <std::input_iterator It>
+        It construct_n(std::size_t offset, It first, std::size_t count)
+        {
+            return elements().construct_n(offset, std::move(first), count);
+        }
+
+        void destroy_n(std::size_t offset, std::size_t count) noexcept { elements().destroy_n(offset, count); }
+
+        void adopt_n(std::size_t offset, std::size_t count) noexcept
+            requires ImplicitLifetime<T>
+        {
+            elements().adopt_n(offset, count);
+        }
+
+        // always a single std::memmove
+        void relocate_n(std::size_t dst, std::size_t src, std::size_t count) noexcept
+        {
+            elements().relocate_n(dst, src, count);
+        }
+
+        // always a single std::memcpy
+        void relocate_n_from(std::size_t dst, MappedBuffer& other, std::size_t src, std::size_t count) noexcept
+        {
+            elements().relocate_n_from(dst, other.elements(), src, count);
+        }
+
+        // grow to size elements, the elements keep their offset but data() may change
+        // throws std::system_error when the memory can't be mapped, the buffer is left untouched
+        void grow(std::size_t size);
+
+        T*       data() noexcept { return m_data; }
+        const T* data() const noexcept { return m_data; }
+
+        auto&        at(std::size_t pos) & noexcept { return m_data[pos]; }
+        auto&&       at(std::size_t pos) && noexcept { return m_data[pos]; }
+        const auto&  at(std::size_t pos) const& noexcept { return std::as_const(m_data[pos]); }
+        const auto&& at(std::size_t pos) const&& noexcept { return std::as_const(m_data[pos]); }
+
+        std::size_t size() const noexcept { return m_size; }
+
+    private:
+        T*          m_data = nullptr;
+        std::size_t m_size = 0;
+
+        [[no_unique_address]] ConstructedFlags<> m_constructed = {};
+
+        Elements<T, std::allocator<T>, std::dynamic_extent> elements() noexcept
+        {
+            return { {}, m_data, m_constructed };
+        }
+
+        // the length of the mapping that holds size elements
+        static std::size_t mapped_bytes(std::size_t size) noexcept;
+
+        void unmap() noexcept;
+    };
+}
+
+// -----------------------------------------------------------------------------
+// implementation detail
+// -----------------------------------------------------------------------------
+
+namespace circbuf::detail
+{
+    template <typename T>
+    MappedBuffer<T>::MappedBuffer(std::size_t size)
+    {
+        if (size == 0) {
+            return;
+        }
+
+        auto prot  = PROT_READ | PROT_WRITE;
+        auto flags = MAP_PRIVATE | MAP_ANONYMOUS;
+        auto* addr = ::mmap(nullptr, mapped_bytes(size), prot, flags, -1, 0);
+        if (addr == MAP_FAILED) {
+            throw std::system_error{ errno, std::system_category(), "mmap" };
+        }
+
+        m_data = static_cast<T*>(addr);
+        m_size = size;
+
+        m_constructed.resize(m_size);
+    }
+
+    template <typename T>
+    MappedBuffer<T>::~MappedBuffer()
+    {
+        if (m_data == nullptr) {
+            return;
+        }
+
+        m_constructed.assert_destroyed();
+
+        unmap();
+    }
+
+    template <typename T>
+    MappedBuffer<T>::MappedBuffer(MappedBuffer&& other) noexcept
+        : m_data{ std::exchange(other.m_data, nullptr) }
+        , m_size{ std::exchange(other.m_size, 0) }
+        , m_constructed{ std::exchange(other.m_constructed, {}) }
+    {
+    }
+
+    template <typename T>
+    MappedBuffer<T>& MappedBuffer<T>::operator=(MappedBuffer&& other) noexcept
+    {
+        if (this == &other) {
+            return *this;
+        }
+
+        if (m_data) {
+            unmap();
+        }
+
+        m_data        = std::exchange(other.m_data, nullptr);
+        m_size        = std::exchange(other.m_size, 0);
+        m_constructed = std::exchange(other.m_constructed, {});
+
+        return *this;
+    }
+
+    template <typename T>
+    void MappedBuffer<T>::grow(std::size_t size)
+    {
+        assert(size >= m_size && "MappedBuffer can only grow");
+
+        if (m_data == nullptr) {
+            *this = MappedBuffer{ size };
+            return;
+        }
+
+        m_constructed.resize(size);    // before the remap so that nothing can fail after it
+
+        auto old_bytes = mapped_bytes(m_size);
+        auto new_bytes = mapped_bytes(size);
+
+        if (new_bytes != old_bytes) {
+            auto* addr = ::mremap(m_data, old_bytes, new_bytes, MREMAP_MAYMOVE);
+            if (addr == MAP_FAILED) {
+                m_constructed.resize(m_size);
+                throw std::system_error{ errno, std::system_category(), "mremap" };
+            }
+            m_data = static_cast<T*>(addr);
+        }
+
+        m_size = size;
+    }
+
+    template <typename T>
+    std::size_t MappedBuffer<T>::mapped_bytes(std::size_t size) noexcept
+    {
+        auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        return (size * sizeof(T) + page - 1) / page * page;
+    }
+
+    template <typename T>
+    void MappedBuffer<T>::unmap() noexcept
+    {
+        ::munmap(m_data, mapped_bytes(m_size));
+        m_data = nullptr;
+        m_size = 0;
+    }
+}
+
+#endif /* end of include guard: CIRCBUF_MAPPED_BUFFER_HPP */
@@ -0,0 +1,209 @@
+#ifndef CIRCBUF_MIRRORED_BUFFER_HPP
+#define CIRCBUF_MIRRORED_BUFFER_HPP
+
+#include "circbuf/detail/storage.hpp"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cassert>
+#include <cerrno>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <numeric>
+#include <system_error>
+#include <utility>
+
+namespace circbuf::detail
+{
+    // same as RawBuffer but the memory is mapped twice back to back (Linux only): data()[i] and data()[i + size()]
+    // are the same element, so size() elements starting anywhere in [0, size()) are contiguous in memory
+    // - size() is rounded up to fill whole pages
+    // - the elements are accessed through both mappings so only implicit-lifetime types are allowed
+    template <typename T>
+    class MirroredBuffer
+    {
+    public:
+        static_assert(ImplicitLifetime<T>, "MirroredBuffer elements must be trivially copyable");
+
+        static constexpr bool mirrored = true;
+
+        MirroredBuffer() = default;
+
+        // throws std::system_error when the memory can't be mapped
+        explicit MirroredBuffer(std::size_t size);
+        ~MirroredBuffer();
+
+        MirroredBuffer(MirroredBuffer&& other) noexcept;
+        MirroredBuffer& operator=(MirroredBuffer&& other) noexcept;
+
+        MirroredBuffer(const MirroredBuffer&)            = delete;
+        MirroredBuffer& operator=(const MirroredBuffer&) = delete;
+
+        // the element functions, see Elements
+        template <typename... Ts>
+        T& construct(std::size_t offset, Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>)
+        {
+            return elements().construct(offset, std::forward<Ts>(args)...);
+        }
+
+        void destroy(std::size_t offset) noexcept { elements().destroy(offset); }
+
+        template <std::input_iterator It>
+        It construct_n(std::size_t offset, It first, std::size_t count)
+        {
+            return elements().construct_n(offset, std::move(first), count);
+        }
+
+        void destroy_n(std::size_t offset, std::size_t count) noexcept { elements().destroy_n(offset, count); }
+
+        void adopt_n(std::size_t offset, std::size_t count) noexcept { elements().adopt_n(offset, count); }
+
+        // always a single std::memmove
+        void relocate_n(std::size_t dst, std::size_t src, std::size_t count) noexcept
+        {
+            elements().relocate_n(dst, src, count);
+        }
+
+        // always a single std::memcpy
+        void relocate_n_from(std::size_t dst, MirroredBuffer& other, std::size_t src, std::size_t count) noexcept
+        {
+            elements().relocate_n_from(dst, other.elements(), src, count);
+        }
+
+        // valid for 2 * size() elements
+        T*       data() noexcept { return m_data; }
+        const T* data() const noexcept { return m_data; }
+
+        auto&        at(std::size_t pos) & noexcept { return m_data[pos]; }
+        auto&&       at(std::size_t pos) && noexcept { return m_data[pos]; }
+        const auto&  at(std::size_t pos) const& noexcept { return std::as_const(m_data[pos]); }
+        const auto&& at(std::size_t pos) const&& noexcept { return std::as_const(m_data[pos]); }
+
+        std::size_t size() const noexcept { return m_size; }
+
+    private:
+        T*          m_data = nullptr;
+        std::size_t m_size = 0;
+
+        [[no_unique_address]] ConstructedFlags<> m_constructed = {};
+
+        Elements<T, std::allocator<T>, std::dynamic_extent> elements() noexcept
+        {
+            return { {}, m_data, m_constructed };
+        }
+
+        void unmap() noexcept;
+    };
+}
+
+// -----------------------------------------------------------------------------
+// implementation detail
+// -----------------------------------------------------------------------------
+
+namespace circbuf::detail
+{
+    template <typename T>
+    MirroredBuffer<T>::MirroredBuffer(std::size_t size)
+    {
+        if (size == 0) {
+            return;
+        }
+
+        auto page  = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        auto unit  = std::lcm(page, sizeof(T));
+        auto bytes = (size * sizeof(T) + unit - 1) / unit * unit;
+
+        // the error is taken right after the failing call, the cleanup below may overwrite errno
+        auto fail = [](int error, const char* what) { throw std::system_error{ error, std::system_category(), what }; };
+
+        auto fd = ::memfd_create("circbuf", MFD_CLOEXEC);
+        if (fd == -1) {
+            fail(errno, "memfd_create");
+        }
+
+        if (::ftruncate(fd, static_cast<off_t>(bytes)) == -1) {
+            auto error = errno;
+            ::close(fd);
+            fail(error, "ftruncate");
+        }
+
+        // reserve the whole range first so that the two mappings end up next to each other
+        auto* reserved = ::mmap(nullptr, 2 * bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (reserved == MAP_FAILED) {
+            auto error = errno;
+            ::close(fd);
+            fail(error, "mmap");
+        }
+
+        auto* base  = static_cast<std::byte*>(reserved);
+        auto  prot  = PROT_READ | PROT_WRITE;
+        auto  flags = MAP_SHARED | MAP_FIXED;
+        auto  error = 0;
+        if (::mmap(base, bytes, prot, flags, fd, 0) == MAP_FAILED
+            or ::mmap(base + bytes, bytes, prot, flags, fd, 0) == MAP_FAILED) {
+            error = errno;
+        }
+        ::close(fd);
+
+        if (error != 0) {
+            ::munmap(reserved, 2 * bytes);
+            fail(error, "mmap");
+        }
+
+        m_data = reinterpret_cast<T*>(base);
+        m_size = bytes / sizeof(T);
+
+        m_constructed.resize(m_size);
+    }
+
+    template <typename T>
+    MirroredBuffer<T>::~MirroredBuffer()
+    {
+        if (m_data == nullptr) {
+            return;
+        }
+
+        m_constructed.assert_destroyed();
+
+        unmap();
+    }
+
+    template <typename T>
+    MirroredBuffer<T>::MirroredBuffer(MirroredBuffer&& other) noexcept
+        : m_data{ std::exchange(other.m_data, nullptr) }
+        , m_size{ std::exchange(other.m_size, 0) }
+        , m_constructed{ std::exchange(other.m_constructed, {}) }
+    {
+    }
+
+    template <typename T>
+    MirroredBuffer<T>& MirroredBuffer<T>::operator=(MirroredBuffer&& other) noexcept
+    {
+        if (this == &other) {
+            return *this;
+        }
+
+        if (m_data) {
+            unmap();
+        }
+
+        m_data        = std::exchange(other.m_data, nullptr);
+        m_size        = std::exchange(other.m_size, 0);
+        m_constructed = std::exchange(other.m_constructed, {});
+
+        return *this;
+    }
+
+    template <typename T>
+    void MirroredBuffer<T>::unmap() noexcept
+    {
+        ::munmap(m_data, 2 * m_size * sizeof(T));
+        m_data = nullptr;
+        m_size = 0;
+    }
+}
+
+#endif /* end of include guard: CIRCBUF_MIRRORED_BUFFER_HPP */
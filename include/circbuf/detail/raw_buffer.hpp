@@ -1,31 +1,32 @@
 #ifndef CIRCBUF_RAW_BUFFER_HPP
 #define CIRCBUF_RAW_BUFFER_HPP
 
+#include "circbuf/detail/storage.hpp"
+
 #include <cassert>
 #include <cstddef>
+#include <iterator>
 #include <memory>
+#include <span>
+#include <type_traits>
 #include <utility>
 
-#ifndef CIRCBUF_RAW_BUFFER_DEBUG
-#    ifdef NDEBUG
-#        define CIRCBUF_RAW_BUFFER_DEBUG 0
-#    else
-#        define CIRCBUF_RAW_BUFFER_DEBUG 1
-#        include <vector>
-#        include <algorithm>
-#    endif
-#endif
-
 namespace circbuf::detail
 {
     // an encapsulation of a raw buffer/memory that propagates the constness of the buffer to the elements
-    template <typename T>
+    // - the memory is obtained from A and the elements are constructed/destroyed through std::allocator_traits<A>
+    // - move construction copies the allocator, move assignment only takes it if it propagates on move assignment
+    //   otherwise both allocators must compare equal (the owner moves the elements one by one when they don't)
+    template <typename T, typename A = std::allocator<T>>
     class RawBuffer
     {
     public:
+        using allocator_type = A;
+
         RawBuffer() = default;
 
-        explicit RawBuffer(std::size_t size);
+        explicit RawBuffer(const A& allocator) noexcept;
+        explicit RawBuffer(std::size_t size, const A& allocator = A());
         ~RawBuffer();
 
         RawBuffer(RawBuffer&& other) noexcept;
@@ -34,13 +35,45 @@ namespace circbuf::detail
         RawBuffer(const RawBuffer&)            = delete;
         RawBuffer& operator=(const RawBuffer&) = delete;
 
+        // the element functions, see Elements
         template <typename... Ts>
-        T& construct(std::size_t offset, Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>);
+        T& construct(std::size_t offset, Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>)
+        {
+            return elements().construct(offset, std::forward<Ts>(args)...);
+        }
 
-        void destroy(std::size_t offset) noexcept;
+        void destroy(std::size_t offset) noexcept { elements().destroy(offset); }
 
-        auto*       data() noexcept { return &at(0); }
-        const auto* data() const noexcept { return &std::as_const(at(0)); }
+        template <std::input_iterator It>
+        It construct_n(std::size_t offset, It first, std::size_t count)
+        {
+            return elements().construct_n(offset, std::move(first), count);
+        }
+
+        void destroy_n(std::size_t offset, std::size_t count) noexcept { elements().destroy_n(offset, count); }
+
+        void adopt_n(std::size_t offset, std::size_t count) noexcept
+            requires ImplicitLifetime<T>
+        {
+            elements().adopt_n(offset, count);
+        }
+
+        void relocate_n(std::size_t dst, std::size_t src, std::size_t count) noexcept(
+            std::is_nothrow_move_constructible_v<T>
+        )
+        {
+            elements().relocate_n(dst, src, count);
+        }
+
+        void relocate_n_from(std::size_t dst, RawBuffer& other, std::size_t src, std::size_t count) noexcept(
+            std::is_nothrow_move_constructible_v<T>
+        )
+        {
+            elements().relocate_n_from(dst, other.elements(), src, count);
+        }
+
+        T*       data() noexcept { return m_data; }
+        const T* data() const noexcept { return m_data; }
 
         auto&        at(std::size_t pos) & noexcept { return m_data[pos]; }
         auto&&       at(std::size_t pos) && noexcept { return m_data[pos]; }
@@ -49,15 +82,33 @@ namespace circbuf::detail
 
         std::size_t size() const noexcept { return m_size; }
 
+        A get_allocator() const noexcept { return m_allocator; }
+
+        // swaps the allocators only if they propagate on swap, otherwise they must compare equal
+        friend void swap(RawBuffer& lhs, RawBuffer& rhs) noexcept
+        {
+            if constexpr (Traits::propagate_on_container_swap::value) {
+                std::swap(lhs.m_allocator, rhs.m_allocator);
+            } else {
+                assert(lhs.m_allocator == rhs.m_allocator && "Memory can't be swapped between different allocators");
+            }
+
+            std::swap(lhs.m_data, rhs.m_data);
+            std::swap(lhs.m_size, rhs.m_size);
+            std::swap(lhs.m_constructed, rhs.m_constructed);
+        }
+
     private:
-        [[no_unique_address]] std::allocator<T> m_allocator = {};
+        using Traits = std::allocator_traits<A>;
+
+        [[no_unique_address]] A m_allocator = {};
 
         T*          m_data = nullptr;
         std::size_t m_size = 0;
 
-#if CIRCBUF_RAW_BUFFER_DEBUG
-        std::vector<bool> m_constructed = {};
-#endif
+        [[no_unique_address]] ConstructedFlags<> m_constructed = {};
+
+        Elements<T, A, std::dynamic_extent> elements() noexcept { return { m_allocator, m_data, m_constructed }; }
     };
 }
 
@@ -67,90 +118,66 @@ namespace circbuf::detail
 
 namespace circbuf::detail
 {
-    template <typename T>
-    RawBuffer<T>::RawBuffer(std::size_t size)
-        : m_data{ m_allocator.allocate(size) }
+    template <typename T, typename A>
+    RawBuffer<T, A>::RawBuffer(const A& allocator) noexcept
+        : m_allocator{ allocator }
+    {
+    }
+
+    template <typename T, typename A>
+    RawBuffer<T, A>::RawBuffer(std::size_t size, const A& allocator)
+        : m_allocator{ allocator }
+        , m_data{ size > 0 ? Traits::allocate(m_allocator, size) : nullptr }
         , m_size{ size }
-#if CIRCBUF_RAW_BUFFER_DEBUG
-        , m_constructed(size, false)
-#endif
+        , m_constructed{ size }
     {
     }
 
-    template <typename T>
-    RawBuffer<T>::~RawBuffer()
+    template <typename T, typename A>
+    RawBuffer<T, A>::~RawBuffer()
     {
         if (m_data == nullptr) {
             return;
         }
 
-#if CIRCBUF_RAW_BUFFER_DEBUG
-        assert(
-            std::all_of(
-                m_constructed.begin(), m_constructed.end(), [](bool constructed) { return !constructed; }
-            )
-            && "Not all elements are destructed"
-        );
-#endif
+        m_constructed.assert_destroyed();
 
-        m_allocator.deallocate(m_data, m_size);
+        Traits::deallocate(m_allocator, m_data, m_size);
         m_data = nullptr;
     }
 
-    template <typename T>
-    RawBuffer<T>::RawBuffer(RawBuffer&& other) noexcept
-        : m_data{ std::exchange(other.m_data, nullptr) }
+    template <typename T, typename A>
+    RawBuffer<T, A>::RawBuffer(RawBuffer&& other) noexcept
+        : m_allocator{ other.m_allocator }    // other keeps a usable allocator
+        , m_data{ std::exchange(other.m_data, nullptr) }
         , m_size{ std::exchange(other.m_size, 0) }
-#if CIRCBUF_RAW_BUFFER_DEBUG
         , m_constructed{ std::exchange(other.m_constructed, {}) }
-#endif
     {
     }
 
-    template <typename T>
-    RawBuffer<T>& RawBuffer<T>::operator=(RawBuffer&& other) noexcept
+    template <typename T, typename A>
+    RawBuffer<T, A>& RawBuffer<T, A>::operator=(RawBuffer&& other) noexcept
     {
         if (this == &other) {
             return *this;
         }
 
         if (m_data) {
-            m_allocator.deallocate(m_data, m_size);
+            Traits::deallocate(m_allocator, m_data, m_size);
         }
 
-        m_data = std::exchange(other.m_data, nullptr);
-        m_size = std::exchange(other.m_size, 0);
+        if constexpr (Traits::propagate_on_container_move_assignment::value) {
+            m_allocator = other.m_allocator;
+        } else {
+            assert(m_allocator == other.m_allocator && "Memory can't be taken from a different allocator");
+        }
 
-#if CIRCBUF_RAW_BUFFER_DEBUG
+        m_data        = std::exchange(other.m_data, nullptr);
+        m_size        = std::exchange(other.m_size, 0);
         m_constructed = std::exchange(other.m_constructed, {});
-#endif
 
         return *this;
     }
-
-    template <typename T>
-    template <typename... Ts>
-    T& RawBuffer<T>::construct(
-        std::size_t offset,
-        Ts&&... args
-    ) noexcept(std::is_nothrow_constructible_v<T, Ts...>)
-    {
-#if CIRCBUF_RAW_BUFFER_DEBUG
-        assert(!m_constructed[offset] && "Element not constructed");
-        m_constructed[offset] = true;
-#endif
-        return *std::construct_at(m_data + offset, std::forward<Ts>(args)...);
-    }
-
-    template <typename T>
-    void RawBuffer<T>::destroy(std::size_t offset) noexcept
-    {
-#if CIRCBUF_RAW_BUFFER_DEBUG
-        assert(m_constructed[offset] && "Element not constructed");
-        m_constructed[offset] = false;
-#endif
-        std::destroy_at(m_data + offset);
-    }
 }
 
 #endif /* end of include guard: CIRCBUF_RAW_BUFFER_HPP */
@@ -0,0 +1,294 @@
+#ifndef CIRCBUF_STORAGE_HPP
+#define CIRCBUF_STORAGE_HPP
+
+#include "circbuf/relocatable.hpp"
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+#ifndef CIRCBUF_RAW_BUFFER_DEBUG
+#    ifdef NDEBUG
+#        define CIRCBUF_RAW_BUFFER_DEBUG 0
+#    else
+#        define CIRCBUF_RAW_BUFFER_DEBUG 1
+#    endif
+#endif
+
+#if CIRCBUF_RAW_BUFFER_DEBUG
+#    include <algorithm>
+#    include <array>
+#    include <functional>
+#    include <vector>
+#endif
+
+namespace circbuf::detail
+{
+    // elements can be copied from the iterator using std::memcpy
+    template <typename T, typename It>
+    concept MemcpyableFrom = std::is_trivially_copyable_v<T> and std::contiguous_iterator<It>
+                         and std::same_as<std::remove_cv_t<std::iter_value_t<It>>, T>;
+
+    // elements can be written directly into the raw memory, their lifetime starts implicitly
+    template <typename T>
+    concept ImplicitLifetime = std::is_trivially_copyable_v<T> and std::is_trivially_default_constructible_v<T>;
+
+#if CIRCBUF_RAW_BUFFER_DEBUG
+    // which elements of a storage are constructed, asserted on by Elements to catch lifetime bugs of the owner
+    // - N is the size of a storage with a fixed size, std::dynamic_extent if it is only known at runtime
+    // - not std::vector<bool>, one byte per element so that construct/destroy on different elements from different
+    //   threads (e.g. SpscQueue) don't race with each other
+    template <std::size_t N = std::dynamic_extent>
+    class ConstructedFlags
+    {
+    public:
+        ConstructedFlags() = default;
+
+        explicit ConstructedFlags(std::size_t size)
+            requires (N == std::dynamic_extent)
+            : m_flags(size, false)
+        {
+        }
+
+        void resize(std::size_t size)
+            requires (N == std::dynamic_extent)
+        {
+            m_flags.resize(size, false);
+        }
+
+        // mark count elements starting at offset as constructed, none of them may be already
+        void set(std::size_t offset, std::size_t count) noexcept
+        {
+            assert(
+                std::none_of(m_flags.begin() + offset, m_flags.begin() + offset + count, std::identity{})
+                && "Element already constructed"
+            );
+            std::fill_n(m_flags.begin() + offset, count, true);
+        }
+
+        // mark count elements starting at offset as destroyed, all of them must be constructed
+        void reset(std::size_t offset, std::size_t count) noexcept
+        {
+            assert(
+                std::all_of(m_flags.begin() + offset, m_flags.begin() + offset + count, std::identity{})
+                && "Element not constructed"
+            );
+            std::fill_n(m_flags.begin() + offset, count, false);
+        }
+
+        void assert_destroyed() const noexcept
+        {
+            assert(std::none_of(m_flags.begin(), m_flags.end(), std::identity{}) && "Not all elements are destructed");
+        }
+
+    private:
+        using Flags = std::conditional_t<
+            N == std::dynamic_extent,
+            std::vector<unsigned char>,
+            std::array<unsigned char, N>>;
+
+        Flags m_flags = {};
+    };
+#else
+    // nothing is tracked without CIRCBUF_RAW_BUFFER_DEBUG
+    template <std::size_t N = std::dynamic_extent>
+    class ConstructedFlags
+    {
+    public:
+        ConstructedFlags() = default;
+
+        explicit ConstructedFlags(std::size_t) noexcept
+            requires (N == std::dynamic_extent)
+        {
+        }
+
+        void resize(std::size_t) noexcept
+            requires (N == std::dynamic_extent)
+        {
+        }
+
+        void set(std::size_t, std::size_t) noexcept { }
+        void reset(std::size_t, std::size_t) noexcept { }
+        void assert_destroyed() const noexcept { }
+    };
+#endif
+
+    // the element lifetime functions shared by every storage (RawBuffer, InlineBuffer, MirroredBuffer and
+    // MappedBuffer): a view over the memory of a storage, its allocator and its ConstructedFlags
+    // - the elements are constructed/destroyed through std::allocator_traits<A>, the storages without an allocator
+    //   use std::allocator<T> which is the same as std::construct_at/std::destroy_at
+    template <typename T, typename A, std::size_t N>
+    class Elements
+    {
+    public:
+        Elements(const A& allocator, T* data, ConstructedFlags<N>& constructed) noexcept
+            : m_allocator{ allocator }
+            , m_data{ data }
+            , m_constructed{ constructed }
+        {
+        }
+
+        template <typename... Ts>
+        T& construct(std::size_t offset, Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>);
+
+        void destroy(std::size_t offset) noexcept;
+
+        // construct count elements starting at offset from the elements pointed by first, returns the iterator
+        // past the last element used; on exception the elements constructed so far are destroyed
+        template <std::input_iterator It>
+        It construct_n(std::size_t offset, It first, std::size_t count);
+
+        void destroy_n(std::size_t offset, std::size_t count) noexcept;
+
+        // take count elements starting at offset as constructed, for elements written directly into the memory
+        void adopt_n(std::size_t offset, std::size_t count) noexcept
+            requires ImplicitLifetime<T>;
+
+        // move count elements from src to dst (the ranges may overlap), the elements end up constructed at dst
+        // and the part of src that is not overwritten is left unconstructed; trivially relocatable elements are
+        // moved with a single std::memmove, the others one by one with move construct + destroy
+        void relocate_n(std::size_t dst, std::size_t src, std::size_t count) noexcept(
+            std::is_nothrow_move_constructible_v<T>
+        );
+
+        // same as relocate_n but the elements come from another storage, a single std::memcpy for trivially
+        // relocatable elements
+        void relocate_n_from(std::size_t dst, Elements other, std::size_t src, std::size_t count) noexcept(
+            std::is_nothrow_move_constructible_v<T>
+        );
+
+    private:
+        using Traits = std::allocator_traits<A>;
+
+        [[no_unique_address]] A m_allocator;
+
+        T*                   m_data;
+        ConstructedFlags<N>& m_constructed;
+    };
+}
+
+// -----------------------------------------------------------------------------
+// implementation detail
+// -----------------------------------------------------------------------------
+
+namespace circbuf::detail
+{
+    template <typename T, typename A, std::size_t N>
+    template <typename... Ts>
+    T& Elements<T, A, N>::construct(
+        std::size_t offset,
+        Ts&&... args
+    ) noexcept(std::is_nothrow_constructible_v<T, Ts...>)
+    {
+        Traits::construct(m_allocator, m_data + offset, std::forward<Ts>(args)...);
+        m_constructed.set(offset, 1);
+        return m_data[offset];
+    }
+
+    template <typename T, typename A, std::size_t N>
+    void Elements<T, A, N>::destroy(std::size_t offset) noexcept
+    {
+        m_constructed.reset(offset, 1);
+        Traits::destroy(m_allocator, m_data + offset);
+    }
+
+    template <typename T, typename A, std::size_t N>
+    template <std::input_iterator It>
+    It Elements<T, A, N>::construct_n(std::size_t offset, It first, std::size_t count)
+    {
+        if constexpr (MemcpyableFrom<T, It>) {
+            if (count > 0) {
+                std::memcpy(m_data + offset, std::to_address(first), count * sizeof(T));
+            }
+            first += static_cast<std::iter_difference_t<It>>(count);
+        } else {
+            std::size_t i = 0;
+            try {
+                for (; i < count; ++i, ++first) {
+                    Traits::construct(m_allocator, m_data + offset + i, *first);
+                }
+            } catch (...) {
+                for (std::size_t j = 0; j < i; ++j) {
+                    Traits::destroy(m_allocator, m_data + offset + j);
+                }
+                throw;
+            }
+        }
+
+        m_constructed.set(offset, count);
+        return first;
+    }
+
+    template <typename T, typename A, std::size_t N>
+    void Elements<T, A, N>::destroy_n(std::size_t offset, std::size_t count) noexcept
+    {
+        m_constructed.reset(offset, count);
+        for (std::size_t i = 0; i < count; ++i) {
+            Traits::destroy(m_allocator, m_data + offset + i);
+        }
+    }
+
+    template <typename T, typename A, std::size_t N>
+    void Elements<T, A, N>::adopt_n(std::size_t offset, std::size_t count) noexcept
+        requires ImplicitLifetime<T>
+    {
+        m_constructed.set(offset, count);
+    }
+
+    template <typename T, typename A, std::size_t N>
+    void Elements<T, A, N>::relocate_n(std::size_t dst, std::size_t src, std::size_t count) noexcept(
+        std::is_nothrow_move_constructible_v<T>
+    )
+    {
+        if (dst == src or count == 0) {
+            return;
+        }
+
+        if constexpr (TriviallyRelocatable<T>) {
+            m_constructed.reset(src, count);
+            m_constructed.set(dst, count);
+            std::memmove(static_cast<void*>(m_data + dst), m_data + src, count * sizeof(T));
+        } else if (dst < src) {
+            for (std::size_t i = 0; i < count; ++i) {
+                construct(dst + i, std::move(m_data[src + i]));
+                destroy(src + i);
+            }
+        } else {
+            for (std::size_t i = count; i-- > 0;) {
+                construct(dst + i, std::move(m_data[src + i]));
+                destroy(src + i);
+            }
+        }
+    }
+
+    template <typename T, typename A, std::size_t N>
+    void Elements<T, A, N>::relocate_n_from(
+        std::size_t dst,
+        Elements    other,
+        std::size_t src,
+        std::size_t count
+    ) noexcept(std::is_nothrow_move_constructible_v<T>)
+    {
+        if (count == 0) {
+            return;
+        }
+
+        if constexpr (TriviallyRelocatable<T>) {
+            other.m_constructed.reset(src, count);
+            m_constructed.set(dst, count);
+            std::memcpy(static_cast<void*>(m_data + dst), other.m_data + src, count * sizeof(T));
+        } else {
+            for (std::size_t i = 0; i < count; ++i) {
+                construct(dst + i, std::move(other.m_data[src + i]));
+                other.destroy(src + i);
+            }
+        }
+    }
+}
+
+#endif /* end of include guard: CIRCBUF_STORAGE_HPP */
@@ -17,6 +17,16 @@ namespace circbuf
 
 namespace circbuf::error
 {
+    // the exceptions below as a plain value, returned by the try_* functions of CircBuf instead of throwing
+    enum class Code
+    {
+        None = 0,
+        ZeroCapacity,
+        BufferFull,
+        BufferEmpty,
+        OutOfRange,
+    };
+
     struct BufferFull : public ::circbuf::Error
     {
         BufferFull(std::size_t capacity)
@@ -49,6 +59,14 @@ namespace circbuf::error
         }
     };
 
+    struct InvalidPolicy : public ::circbuf::Error
+    {
+        InvalidPolicy(const std::string& what)
+            : Error{ std::format("Policy can't be used here: {}", what) }
+        {
+        }
+    };
+
     struct NotLinearizedNotFull : public ::circbuf::Error
     {
         NotLinearizedNotFull(const std::string& what)
@@ -0,0 +1,89 @@
+#ifndef CIRCBUF_IO_HPP
+#define CIRCBUF_IO_HPP
+
+#include "circbuf/circbuf.hpp"
+
+#include <sys/types.h>
+#include <sys/uio.h>
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <limits>
+
+// POSIX only: moves bytes between a file descriptor and a CircBuf with a single readv/writev call, the two
+// segments of the buffer are passed to the syscall directly so nothing is copied in between
+namespace circbuf::io
+{
+    template <typename T>
+    concept Byte = sizeof(T) == 1 and detail::ImplicitLifetime<T>;
+
+    // read at most count bytes from fd into the free space after the tail, the buffer is never overwritten so at
+    // most capacity() - size() bytes are read; the buffer doesn't grow either, whatever its policy
+    // returns the value returned by readv: the number of bytes read, 0 on end of file or -1 with errno set
+    // when there is nothing to read into (full buffer or count == 0) readv is not called and -1 is returned with
+    // errno set to ENOBUFS, so that 0 always means end of file
+    template <Byte T, BufferCapacityPolicy C, typename S, typename P>
+    ssize_t read(int fd, CircBuf<T, C, S, P>& buffer, std::size_t count = std::numeric_limits<std::size_t>::max());
+
+    // write at most count bytes from the head of the buffer to fd, the bytes written are removed from the buffer
+    // returns the value returned by writev: the number of bytes written or -1 with errno set
+    template <Byte T, BufferCapacityPolicy C, typename S, typename P>
+    ssize_t write(int fd, CircBuf<T, C, S, P>& buffer, std::size_t count = std::numeric_limits<std::size_t>::max());
+}
+
+// -----------------------------------------------------------------------------
+// implementation detail
+// -----------------------------------------------------------------------------
+
+namespace circbuf::detail
+{
+    // returns the number of iovec used
+    template <typename T>
+    int to_iovec(const Segments<T>& segments, std::array<iovec, 2>& iov) noexcept
+    {
+        iov[0] = { .iov_base = segments.first.data(), .iov_len = segments.first.size() };
+        iov[1] = { .iov_base = segments.second.data(), .iov_len = segments.second.size() };
+
+        return segments.second.empty() ? 1 : 2;
+    }
+}
+
+namespace circbuf::io
+{
+    template <Byte T, BufferCapacityPolicy C, typename S, typename P>
+    ssize_t read(int fd, CircBuf<T, C, S, P>& buffer, std::size_t count)
+    {
+        auto segments = buffer.prepare(count);
+        if (segments.first.empty()) {
+            errno = ENOBUFS;
+            return -1;
+        }
+
+        auto iov    = std::array<iovec, 2>{};
+        auto iovcnt = detail::to_iovec(segments, iov);
+
+        auto result = ::readv(fd, iov.data(), iovcnt);
+        if (result > 0) {
+            buffer.commit(static_cast<std::size_t>(result));
+        }
+
+        return result;
+    }
+
+    template <Byte T, BufferCapacityPolicy C, typename S, typename P>
+    ssize_t write(int fd, CircBuf<T, C, S, P>& buffer, std::size_t count)
+    {
+        auto iov    = std::array<iovec, 2>{};
+        auto iovcnt = detail::to_iovec(buffer.peek(count), iov);
+
+        auto result = ::writev(fd, iov.data(), iovcnt);
+        if (result > 0) {
+            buffer.consume(static_cast<std::size_t>(result));
+        }
+
+        return result;
+    }
+}
+
+#endif /* end of include guard: CIRCBUF_IO_HPP */
@@ -0,0 +1,16 @@
+#ifndef CIRCBUF_MAPPED_CIRCBUF_HPP
+#define CIRCBUF_MAPPED_CIRCBUF_HPP
+
+#include "circbuf/circbuf.hpp"
+#include "circbuf/detail/mapped_buffer.hpp"
+
+namespace circbuf
+{
+    // CircBuf with the memory mapped directly from the OS (Linux only), growing it with resize() remaps the pages in
+    // place (mremap) and relocates only the shorter wrapped part instead of moving every element into a new buffer;
+    // T must be trivially relocatable (see IsTriviallyRelocatable)
+    template <CircBufElement T, BufferCapacityPolicy C = BufferCapacityPolicy::Exact>
+    using MappedCircBuf = CircBuf<T, C, detail::MappedBuffer<T>>;
+}
+
+#endif /* end of include guard: CIRCBUF_MAPPED_CIRCBUF_HPP */
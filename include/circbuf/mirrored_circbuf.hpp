@@ -0,0 +1,16 @@
+#ifndef CIRCBUF_MIRRORED_CIRCBUF_HPP
+#define CIRCBUF_MIRRORED_CIRCBUF_HPP
+
+#include "circbuf/circbuf.hpp"
+#include "circbuf/detail/mirrored_buffer.hpp"
+
+namespace circbuf
+{
+    // CircBuf with the memory mapped twice back to back (Linux only), the elements are always contiguous so data()
+    // never throws and linearize() is a no-op; T must be trivially copyable and the capacity is rounded up to fill
+    // whole pages
+    template <CircBufElement T>
+    using MirroredCircBuf = CircBuf<T, BufferCapacityPolicy::Exact, detail::MirroredBuffer<T>>;
+}
+
+#endif /* end of include guard: CIRCBUF_MIRRORED_CIRCBUF_HPP */
@@ -0,0 +1,257 @@
+#ifndef CIRCBUF_MPMC_QUEUE_HPP
+#define CIRCBUF_MPMC_QUEUE_HPP
+
+#include "circbuf/concurrent.hpp"
+#include "circbuf/detail/cache_line.hpp"
+#include "circbuf/detail/raw_buffer.hpp"
+#include "circbuf/error.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace circbuf
+{
+    // lock-free multi-producer multi-consumer bounded queue (Vyukov), any thread may call any function
+    // - every slot has a sequence number that tells whose turn it is: a producer with ticket t may construct into
+    //   the slot once its sequence is t, a consumer with ticket t may take it out once its sequence is t + 1
+    // - the try_* functions claim a ticket only when its slot is ready, the blocking ones take the next ticket
+    //   unconditionally then wait for the slot according to W
+    template <ConcurrentElement T, WaitStrategy W = YieldWait>
+    class MpmcQueue
+    {
+    public:
+        using Element = T;
+
+        // STL compatibility/compliance [breaking my style, big sad...]
+        using value_type = Element;
+        using size_type  = std::size_t;
+
+        // capacity is rounded up to the next power of two
+        explicit MpmcQueue(std::size_t capacity);
+        ~MpmcQueue();
+
+        MpmcQueue(MpmcQueue&&)                 = delete;
+        MpmcQueue& operator=(MpmcQueue&&)      = delete;
+        MpmcQueue(const MpmcQueue&)            = delete;
+        MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+        // returns false when the queue is full
+        template <typename... Ts>
+        bool try_emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>);
+
+        bool try_push(T&& value) noexcept { return try_emplace(std::move(value)); }
+        bool try_push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
+            requires std::copy_constructible<T>
+        {
+            return try_emplace(value);
+        }
+
+        // returns std::nullopt when the queue is empty
+        std::optional<T> try_pop() noexcept;
+
+        // wait until there is room, then push
+        template <typename... Ts>
+        void emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>);
+
+        void push(T&& value) noexcept { emplace(std::move(value)); }
+        void push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
+            requires std::copy_constructible<T>
+        {
+            emplace(value);
+        }
+
+        // wait until there is an element, then pop
+        T pop() noexcept;
+
+        // only a snapshot when called while other threads are running
+        std::size_t size() const noexcept;
+        std::size_t capacity() const noexcept { return m_buffer.size(); }
+
+        bool empty() const noexcept { return size() == 0; }
+        bool full() const noexcept { return size() == capacity(); }
+
+    private:
+        using Sequence = std::atomic<std::size_t>;
+
+        // the next ticket of the consumers and of the producers, free-running and masked on access
+        alignas(detail::cache_line_size) std::atomic<std::size_t> m_head = 0;
+        alignas(detail::cache_line_size) std::atomic<std::size_t> m_tail = 0;
+
+        // read-only after construction except for the sequences and the elements themselves
+        alignas(detail::cache_line_size) detail::RawBuffer<T> m_buffer;
+        std::unique_ptr<Sequence[]> m_sequences;
+        std::size_t                 m_mask = 0;
+
+        [[no_unique_address]] W m_wait;
+
+        // the element is constructed before the ticket is claimed if T may throw, a claimed slot must be filled
+        template <typename... Ts>
+        void publish(std::size_t ticket, Ts&&... args) noexcept;
+
+        T take(std::size_t ticket) noexcept;
+    };
+}
+
+// -----------------------------------------------------------------------------
+// implementation detail
+// -----------------------------------------------------------------------------
+
+namespace circbuf
+{
+    template <ConcurrentElement T, WaitStrategy W>
+    MpmcQueue<T, W>::MpmcQueue(std::size_t capacity)
+        : m_buffer{ capacity == 0 ? 0 : std::bit_ceil(capacity) }
+        , m_sequences{ std::make_unique<Sequence[]>(m_buffer.size()) }
+        , m_mask{ m_buffer.size() - 1 }
+    {
+        if (capacity == 0) {
+            throw error::ZeroCapacity{ "MpmcQueue can't be created with zero capacity" };
+        }
+
+        for (std::size_t i = 0; i < m_buffer.size(); ++i) {
+            m_sequences[i].store(i, std::memory_order::relaxed);
+        }
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    MpmcQueue<T, W>::~MpmcQueue()
+    {
+        auto head = m_head.load(std::memory_order::relaxed);
+        auto tail = m_tail.load(std::memory_order::relaxed);
+
+        for (; head != tail; ++head) {
+            m_buffer.destroy(head & m_mask);
+        }
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    template <typename... Ts>
+    bool MpmcQueue<T, W>::try_emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>)
+    {
+        auto claim = [&]() noexcept -> std::optional<std::size_t> {
+            auto ticket = m_tail.load(std::memory_order::relaxed);
+
+            while (true) {
+                auto sequence = m_sequences[ticket & m_mask].load(std::memory_order::acquire);
+                auto diff     = static_cast<std::ptrdiff_t>(sequence - ticket);
+
+                if (diff == 0) {
+                    // the slot is free for this ticket, on failure ticket is reloaded and we try the next one
+                    if (m_tail.compare_exchange_weak(ticket, ticket + 1, std::memory_order::relaxed)) {
+                        return ticket;
+                    }
+                } else if (diff < 0) {
+                    return std::nullopt;    // the slot still holds the element of the previous lap: full
+                } else {
+                    ticket = m_tail.load(std::memory_order::relaxed);    // another producer took it
+                }
+            }
+        };
+
+        if constexpr (std::is_nothrow_constructible_v<T, Ts...>) {
+            auto ticket = claim();
+            if (not ticket.has_value()) {
+                return false;
+            }
+            publish(*ticket, std::forward<Ts>(args)...);
+        } else {
+            auto value  = T(std::forward<Ts>(args)...);
+            auto ticket = claim();
+            if (not ticket.has_value()) {
+                return false;
+            }
+            publish(*ticket, std::move(value));
+        }
+
+        return true;
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    std::optional<T> MpmcQueue<T, W>::try_pop() noexcept
+    {
+        auto ticket = m_head.load(std::memory_order::relaxed);
+
+        while (true) {
+            auto sequence = m_sequences[ticket & m_mask].load(std::memory_order::acquire);
+            auto diff     = static_cast<std::ptrdiff_t>(sequence - (ticket + 1));
+
+            if (diff == 0) {
+                if (m_head.compare_exchange_weak(ticket, ticket + 1, std::memory_order::relaxed)) {
+                    return take(ticket);
+                }
+            } else if (diff < 0) {
+                return std::nullopt;    // the producer of this ticket hasn't published yet: empty
+            } else {
+                ticket = m_head.load(std::memory_order::relaxed);    // another consumer took it
+            }
+        }
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    template <typename... Ts>
+    void MpmcQueue<T, W>::emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>)
+    {
+        if constexpr (std::is_nothrow_constructible_v<T, Ts...>) {
+            publish(m_tail.fetch_add(1, std::memory_order::relaxed), std::forward<Ts>(args)...);
+        } else {
+            auto value = T(std::forward<Ts>(args)...);
+            publish(m_tail.fetch_add(1, std::memory_order::relaxed), std::move(value));
+        }
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    T MpmcQueue<T, W>::pop() noexcept
+    {
+        return take(m_head.fetch_add(1, std::memory_order::relaxed));
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    std::size_t MpmcQueue<T, W>::size() const noexcept
+    {
+        // the blocking pop may take a ticket ahead of the producers, so head can be past tail
+        auto head = m_head.load(std::memory_order::acquire);
+        auto tail = m_tail.load(std::memory_order::acquire);
+
+        return tail > head ? std::min(tail - head, capacity()) : 0;
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    template <typename... Ts>
+    void MpmcQueue<T, W>::publish(std::size_t ticket, Ts&&... args) noexcept
+    {
+        auto& sequence = m_sequences[ticket & m_mask];
+
+        // only the blocking emplace can get here before the consumer of the previous lap is done
+        m_wait.wait(sequence, [&] { return sequence.load(std::memory_order::acquire) == ticket; });
+
+        m_buffer.construct(ticket & m_mask, std::forward<Ts>(args)...);
+        sequence.store(ticket + 1, std::memory_order::release);
+        m_wait.notify(sequence);
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    T MpmcQueue<T, W>::take(std::size_t ticket) noexcept
+    {
+        auto& sequence = m_sequences[ticket & m_mask];
+        auto  index    = ticket & m_mask;
+
+        // only the blocking pop can get here before the producer is done
+        m_wait.wait(sequence, [&] { return sequence.load(std::memory_order::acquire) == ticket + 1; });
+
+        auto value = std::move(m_buffer.at(index));
+        m_buffer.destroy(index);
+        sequence.store(ticket + capacity(), std::memory_order::release);
+        m_wait.notify(sequence);
+
+        return value;
+    }
+}
+
+#endif /* end of include guard: CIRCBUF_MPMC_QUEUE_HPP */
@@ -0,0 +1,26 @@
+#ifndef CIRCBUF_RELOCATABLE_HPP
+#define CIRCBUF_RELOCATABLE_HPP
+
+#include <type_traits>
+
+namespace circbuf
+{
+    // moving a trivially relocatable object to another address then destroying the original is the same as copying
+    // its bytes, the storages of CircBuf relocate such elements with std::memmove/std::memcpy instead of move
+    // construct + destroy one by one
+    // - defaults to std::is_trivially_copyable
+    // - specialize it for the types that are not trivially copyable but still qualify, e.g. a type that only
+    //   holds a std::unique_ptr:
+    //
+    //   template <>
+    //   struct circbuf::IsTriviallyRelocatable<Handle> : std::true_type { };
+    template <typename T>
+    struct IsTriviallyRelocatable : std::is_trivially_copyable<T>
+    {
+    };
+
+    template <typename T>
+    concept TriviallyRelocatable = IsTriviallyRelocatable<std::remove_cv_t<T>>::value;
+}
+
+#endif /* end of include guard: CIRCBUF_RELOCATABLE_HPP */
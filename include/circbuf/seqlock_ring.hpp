@@ -0,0 +1,171 @@
+#ifndef CIRCBUF_SEQLOCK_RING_HPP
+#define CIRCBUF_SEQLOCK_RING_HPP
+
+#include "circbuf/concurrent.hpp"
+#include "circbuf/detail/cache_line.hpp"
+#include "circbuf/detail/raw_buffer.hpp"
+#include "circbuf/error.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <optional>
+#include <span>
+#include <type_traits>
+
+namespace circbuf
+{
+    // single-writer many-reader overwrite ring (like BufferPolicy::ReplaceOnFull): the writer never waits for the
+    // readers, the readers copy the latest elements out optimistically and retry when the writer lapped them
+    // - only one thread at a time may call push, any thread may call the other functions
+    // - the storage is twice capacity() so that the writer can push capacity() more elements while a reader copies
+    //   a full window before the reader has to retry
+    // - T must be trivially copyable since readers may copy an element while it is being overwritten, such copies
+    //   are detected afterwards (seqlock) and thrown away
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    class SeqlockRing
+    {
+    public:
+        using Element = T;
+
+        // STL compatibility/compliance [breaking my style, big sad...]
+        using value_type = Element;
+        using size_type  = std::size_t;
+
+        // capacity is rounded up to the next power of two
+        explicit SeqlockRing(std::size_t capacity);
+
+        SeqlockRing(SeqlockRing&&)                 = delete;
+        SeqlockRing& operator=(SeqlockRing&&)      = delete;
+        SeqlockRing(const SeqlockRing&)            = delete;
+        SeqlockRing& operator=(const SeqlockRing&) = delete;
+
+        // writer side, overwrites the oldest element once capacity() elements are kept
+        void push(const T& value) noexcept;
+
+        // reader side: copy the latest min(out.size(), size()) elements into out, oldest first, and return their
+        // number, retries until the copy wasn't overwritten while it was being made
+        std::size_t snapshot(std::span<T> out) const noexcept;
+
+        // reader side: same as snapshot but gives up after the first attempt if the writer lapped it
+        std::optional<std::size_t> try_snapshot(std::span<T> out) const noexcept;
+
+        // reader side: the element pushed last, std::nullopt if nothing was pushed yet
+        std::optional<T> latest() const noexcept;
+
+        // the number of elements pushed so far, free-running
+        std::size_t pushed() const noexcept { return m_published.load(std::memory_order::acquire); }
+
+        std::size_t size() const noexcept { return std::min(pushed(), capacity()); }
+        std::size_t capacity() const noexcept { return m_buffer.size() / 2; }
+
+        bool empty() const noexcept { return size() == 0; }
+
+    private:
+        // the sequences the writer started to write and published
+        alignas(detail::cache_line_size) std::atomic<std::size_t> m_claimed = 0;
+        std::atomic<std::size_t> m_published = 0;
+
+        // read-only after construction, sequences are masked on access
+        alignas(detail::cache_line_size) detail::RawBuffer<T> m_buffer;
+        std::size_t m_mask = 0;
+
+        // copy the latest min(out.size(), size()) elements, std::nullopt if the writer overwrote any of them meanwhile
+        std::optional<std::size_t> copy(std::span<T> out) const noexcept;
+    };
+}
+
+// -----------------------------------------------------------------------------
+// implementation detail
+// -----------------------------------------------------------------------------
+
+namespace circbuf
+{
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    SeqlockRing<T>::SeqlockRing(std::size_t capacity)
+        : m_buffer{ capacity == 0 ? 0 : std::bit_ceil(capacity) * 2 }
+        , m_mask{ m_buffer.size() - 1 }
+    {
+        if (capacity == 0) {
+            throw error::ZeroCapacity{ "SeqlockRing can't be created with zero capacity" };
+        }
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    void SeqlockRing<T>::push(const T& value) noexcept
+    {
+        auto sequence = m_published.load(std::memory_order::relaxed);
+
+        // readers must know that the slot is being written before any of its bytes change
+        m_claimed.store(sequence + 1, std::memory_order::relaxed);
+        std::atomic_thread_fence(std::memory_order::release);
+
+        std::memcpy(m_buffer.data() + (sequence & m_mask), &value, sizeof(T));
+
+        m_published.store(sequence + 1, std::memory_order::release);
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    std::size_t SeqlockRing<T>::snapshot(std::span<T> out) const noexcept
+    {
+        auto count = copy(out);
+        while (not count.has_value()) {
+            detail::cpu_relax();
+            count = copy(out);
+        }
+        return *count;
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    std::optional<std::size_t> SeqlockRing<T>::try_snapshot(std::span<T> out) const noexcept
+    {
+        return copy(out);
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    std::optional<T> SeqlockRing<T>::latest() const noexcept
+    {
+        alignas(T) unsigned char storage[sizeof(T)];
+        auto out = std::span{ reinterpret_cast<T*>(storage), 1 };
+
+        if (snapshot(out) == 0) {
+            return std::nullopt;
+        }
+        return out[0];
+    }
+
+    template <typename T>
+        requires std::is_trivially_copyable_v<T>
+    std::optional<std::size_t> SeqlockRing<T>::copy(std::span<T> out) const noexcept
+    {
+        auto published = m_published.load(std::memory_order::acquire);
+        auto count     = std::min({ out.size(), published, capacity() });
+        auto sequence  = published - count;
+
+        auto start = sequence & m_mask;
+        auto split = std::min(count, m_buffer.size() - start);
+
+        std::memcpy(out.data(), m_buffer.data() + start, split * sizeof(T));
+        std::memcpy(out.data() + split, m_buffer.data(), (count - split) * sizeof(T));
+
+        // the slot of a sequence is rewritten by the writer of sequence + storage size, if that one started already
+        // the copy may be torn
+        std::atomic_thread_fence(std::memory_order::acquire);
+        auto claimed = m_claimed.load(std::memory_order::relaxed);
+
+        if (claimed > sequence + m_buffer.size()) {
+            return std::nullopt;
+        }
+        return count;
+    }
+}
+
+#endif /* end of include guard: CIRCBUF_SEQLOCK_RING_HPP */
@@ -0,0 +1,215 @@
+#ifndef CIRCBUF_SPSC_QUEUE_HPP
+#define CIRCBUF_SPSC_QUEUE_HPP
+
+#include "circbuf/concurrent.hpp"
+#include "circbuf/detail/cache_line.hpp"
+#include "circbuf/detail/raw_buffer.hpp"
+#include "circbuf/error.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace circbuf
+{
+    // lock-free single-producer single-consumer bounded queue
+    // - only one thread at a time may call the producer side functions: try_push, try_emplace, push, emplace
+    // - only one thread at a time may call the consumer side functions: try_pop, pop
+    // - the blocking functions wait for the other side according to W
+    template <ConcurrentElement T, WaitStrategy W = YieldWait>
+    class SpscQueue
+    {
+    public:
+        using Element = T;
+
+        // STL compatibility/compliance [breaking my style, big sad...]
+        using value_type = Element;
+        using size_type  = std::size_t;
+
+        // capacity is rounded up to the next power of two
+        explicit SpscQueue(std::size_t capacity);
+        ~SpscQueue();
+
+        SpscQueue(SpscQueue&&)                 = delete;
+        SpscQueue& operator=(SpscQueue&&)      = delete;
+        SpscQueue(const SpscQueue&)            = delete;
+        SpscQueue& operator=(const SpscQueue&) = delete;
+
+        // producer side, returns false when the queue is full
+        template <typename... Ts>
+        bool try_emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>);
+
+        bool try_push(T&& value) noexcept { return try_emplace(std::move(value)); }
+        bool try_push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
+            requires std::copy_constructible<T>
+        {
+            return try_emplace(value);
+        }
+
+        // consumer side, returns std::nullopt when the queue is empty
+        std::optional<T> try_pop() noexcept;
+
+        // producer side, wait until there is room
+        template <typename... Ts>
+        void emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>);
+
+        void push(T&& value) noexcept { emplace(std::move(value)); }
+        void push(const T& value) noexcept(std::is_nothrow_copy_constructible_v<T>)
+            requires std::copy_constructible<T>
+        {
+            emplace(value);
+        }
+
+        // consumer side, wait until there is an element
+        T pop() noexcept;
+
+        // only a snapshot when called while the other side is running
+        std::size_t size() const noexcept;
+        std::size_t capacity() const noexcept { return m_buffer.size(); }
+
+        bool empty() const noexcept { return size() == 0; }
+        bool full() const noexcept { return size() == capacity(); }
+
+    private:
+        // consumer side: the index it owns and its last seen value of the producer index
+        alignas(detail::cache_line_size) std::atomic<std::size_t> m_head = 0;
+        std::size_t m_tail_cache = 0;
+
+        // producer side: the index it owns and its last seen value of the consumer index
+        alignas(detail::cache_line_size) std::atomic<std::size_t> m_tail = 0;
+        std::size_t m_head_cache = 0;
+
+        // read-only after construction, indices are free-running and masked on access
+        alignas(detail::cache_line_size) detail::RawBuffer<T> m_buffer;
+        std::size_t m_mask = 0;
+
+        [[no_unique_address]] W m_wait;
+    };
+}
+
+// -----------------------------------------------------------------------------
+// implementation detail
+// -----------------------------------------------------------------------------
+
+namespace circbuf
+{
+    template <ConcurrentElement T, WaitStrategy W>
+    SpscQueue<T, W>::SpscQueue(std::size_t capacity)
+        : m_buffer{ capacity == 0 ? 0 : std::bit_ceil(capacity) }
+        , m_mask{ m_buffer.size() - 1 }
+    {
+        if (capacity == 0) {
+            throw error::ZeroCapacity{ "SpscQueue can't be created with zero capacity" };
+        }
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    SpscQueue<T, W>::~SpscQueue()
+    {
+        auto head = m_head.load(std::memory_order::relaxed);
+        auto tail = m_tail.load(std::memory_order::relaxed);
+
+        for (; head != tail; ++head) {
+            m_buffer.destroy(head & m_mask);
+        }
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    template <typename... Ts>
+    bool SpscQueue<T, W>::try_emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>)
+    {
+        auto tail = m_tail.load(std::memory_order::relaxed);
+
+        // only touch the consumer cache line when the queue looks full
+        if (tail - m_head_cache == capacity()) {
+            m_head_cache = m_head.load(std::memory_order::acquire);
+            if (tail - m_head_cache == capacity()) {
+                return false;
+            }
+        }
+
+        m_buffer.construct(tail & m_mask, std::forward<Ts>(args)...);
+        m_tail.store(tail + 1, std::memory_order::release);
+        m_wait.notify(m_tail);
+
+        return true;
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    std::optional<T> SpscQueue<T, W>::try_pop() noexcept
+    {
+        auto head = m_head.load(std::memory_order::relaxed);
+
+        // only touch the producer cache line when the queue looks empty
+        if (head == m_tail_cache) {
+            m_tail_cache = m_tail.load(std::memory_order::acquire);
+            if (head == m_tail_cache) {
+                return std::nullopt;
+            }
+        }
+
+        auto index = head & m_mask;
+        auto value = std::optional<T>{ std::move(m_buffer.at(index)) };
+        m_buffer.destroy(index);
+        m_head.store(head + 1, std::memory_order::release);
+        m_wait.notify(m_head);
+
+        return value;
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    template <typename... Ts>
+    void SpscQueue<T, W>::emplace(Ts&&... args) noexcept(std::is_nothrow_constructible_v<T, Ts...>)
+    {
+        auto tail = m_tail.load(std::memory_order::relaxed);
+
+        if (tail - m_head_cache == capacity()) {
+            m_wait.wait(m_head, [&] {
+                m_head_cache = m_head.load(std::memory_order::acquire);
+                return tail - m_head_cache != capacity();
+            });
+        }
+
+        m_buffer.construct(tail & m_mask, std::forward<Ts>(args)...);
+        m_tail.store(tail + 1, std::memory_order::release);
+        m_wait.notify(m_tail);
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    T SpscQueue<T, W>::pop() noexcept
+    {
+        auto head = m_head.load(std::memory_order::relaxed);
+
+        if (head == m_tail_cache) {
+            m_wait.wait(m_tail, [&] {
+                m_tail_cache = m_tail.load(std::memory_order::acquire);
+                return head != m_tail_cache;
+            });
+        }
+
+        auto index = head & m_mask;
+        auto value = std::move(m_buffer.at(index));
+        m_buffer.destroy(index);
+        m_head.store(head + 1, std::memory_order::release);
+        m_wait.notify(m_head);
+
+        return value;
+    }
+
+    template <ConcurrentElement T, WaitStrategy W>
+    std::size_t SpscQueue<T, W>::size() const noexcept
+    {
+        // head first: tail is only ever moving forward so the difference can't be negative
+        auto head = m_head.load(std::memory_order::acquire);
+        auto tail = m_tail.load(std::memory_order::acquire);
+
+        return std::min(tail - head, capacity());
+    }
+}
+
+#endif /* end of include guard: CIRCBUF_SPSC_QUEUE_HPP */
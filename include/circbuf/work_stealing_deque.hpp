@@ -0,0 +1,214 @@
+#ifndef CIRCBUF_WORK_STEALING_DEQUE_HPP
+#define CIRCBUF_WORK_STEALING_DEQUE_HPP
+
+#include "circbuf/detail/cache_line.hpp"
+#include "circbuf/error.hpp"
+
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace circbuf
+{
+    // a thief may read an element while the owner takes the same one, only one of them wins it afterwards, so the
+    // elements are stored in lock-free atomics: task pointers, indices, handles
+    template <typename T>
+    concept StealableElement = std::is_trivially_copyable_v<T> and std::default_initializable<T>
+                           and std::atomic<T>::is_always_lock_free;
+
+    // lock-free work-stealing deque (Chase-Lev) on a ring that grows when full
+    // - only the owner thread may call push and pop, they work on the back like a stack
+    // - any thread may call steal, it takes from the front with a CAS and may fail when it races with the owner or
+    //   another thief even if the deque is not empty
+    // - a ring that was grown out of is kept until destruction since a thief may still be reading from it
+    template <StealableElement T>
+    class WorkStealingDeque
+    {
+    public:
+        using Element = T;
+
+        // STL compatibility/compliance [breaking my style, big sad...]
+        using value_type = Element;
+        using size_type  = std::size_t;
+
+        // capacity is rounded up to the next power of two, it doubles every time the deque is full
+        explicit WorkStealingDeque(std::size_t capacity);
+
+        WorkStealingDeque(WorkStealingDeque&&)                 = delete;
+        WorkStealingDeque& operator=(WorkStealingDeque&&)      = delete;
+        WorkStealingDeque(const WorkStealingDeque&)            = delete;
+        WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+        // owner side, grows the ring when full (only allocation can throw)
+        void push(T value);
+
+        // owner side, the element pushed last, std::nullopt when empty
+        std::optional<T> pop() noexcept;
+
+        // thief side, the element pushed first, std::nullopt when empty or when another thread took it first
+        std::optional<T> steal() noexcept;
+
+        // only a snapshot when called while other threads are running
+        std::size_t size() const noexcept;
+        std::size_t capacity() const noexcept { return m_ring.load(std::memory_order::acquire)->capacity(); }
+
+        bool empty() const noexcept { return size() == 0; }
+
+    private:
+        using Index = std::int64_t;    // signed: the owner moves bottom below top for a moment when it pops empty
+
+        class Ring
+        {
+        public:
+            explicit Ring(std::size_t capacity)
+                : m_slots{ std::make_unique<std::atomic<T>[]>(capacity) }
+                , m_mask{ capacity - 1 }
+            {
+            }
+
+            T    load(Index index) const noexcept { return slot(index).load(std::memory_order::relaxed); }
+            void store(Index index, T value) noexcept { slot(index).store(value, std::memory_order::relaxed); }
+
+            std::size_t capacity() const noexcept { return m_mask + 1; }
+
+        private:
+            std::unique_ptr<std::atomic<T>[]> m_slots;
+            std::size_t                       m_mask;
+
+            std::atomic<T>& slot(Index index) const noexcept
+            {
+                return m_slots[static_cast<std::size_t>(index) & m_mask];
+            }
+        };
+
+        // thief side: the next index to steal from
+        alignas(detail::cache_line_size) std::atomic<Index> m_top = 0;
+
+        // owner side: the next index to push to, the current ring and the rings it grew out of
+        alignas(detail::cache_line_size) std::atomic<Index> m_bottom = 0;
+        std::atomic<Ring*>                 m_ring = nullptr;
+        std::vector<std::unique_ptr<Ring>> m_rings;
+
+        Ring* grow(Ring* ring, Index top, Index bottom);
+    };
+}
+
+// -----------------------------------------------------------------------------
+// implementation detail
+// -----------------------------------------------------------------------------
+
+namespace circbuf
+{
+    template <StealableElement T>
+    WorkStealingDeque<T>::WorkStealingDeque(std::size_t capacity)
+    {
+        if (capacity == 0) {
+            throw error::ZeroCapacity{ "WorkStealingDeque can't be created with zero capacity" };
+        }
+
+        m_rings.push_back(std::make_unique<Ring>(std::bit_ceil(capacity)));
+        m_ring.store(m_rings.back().get(), std::memory_order::relaxed);
+    }
+
+    template <StealableElement T>
+    void WorkStealingDeque<T>::push(T value)
+    {
+        auto bottom = m_bottom.load(std::memory_order::relaxed);
+        auto top    = m_top.load(std::memory_order::acquire);
+        auto ring   = m_ring.load(std::memory_order::relaxed);
+
+        if (static_cast<std::size_t>(bottom - top) >= ring->capacity()) {
+            ring = grow(ring, top, bottom);
+        }
+
+        ring->store(bottom, value);
+
+        // release: a thief that sees the new bottom also sees the element
+        std::atomic_thread_fence(std::memory_order::release);
+        m_bottom.store(bottom + 1, std::memory_order::relaxed);
+    }
+
+    template <StealableElement T>
+    std::optional<T> WorkStealingDeque<T>::pop() noexcept
+    {
+        auto bottom = m_bottom.load(std::memory_order::relaxed) - 1;
+        auto ring   = m_ring.load(std::memory_order::relaxed);
+
+        // reserve the last element before looking at top, the fence orders the two against the thieves doing the
+        // opposite in steal
+        m_bottom.store(bottom, std::memory_order::relaxed);
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+        auto top = m_top.load(std::memory_order::relaxed);
+
+        if (top > bottom) {
+            m_bottom.store(bottom + 1, std::memory_order::relaxed);    // was empty
+            return std::nullopt;
+        }
+
+        auto value = std::optional<T>{ ring->load(bottom) };
+        if (top == bottom) {
+            // the last element, thieves may be after it too: whoever moves top first wins it
+            if (not m_top.compare_exchange_strong(
+                    top, top + 1, std::memory_order::seq_cst, std::memory_order::relaxed
+                )) {
+                value.reset();
+            }
+            m_bottom.store(bottom + 1, std::memory_order::relaxed);
+        }
+
+        return value;
+    }
+
+    template <StealableElement T>
+    std::optional<T> WorkStealingDeque<T>::steal() noexcept
+    {
+        auto top = m_top.load(std::memory_order::acquire);
+        std::atomic_thread_fence(std::memory_order::seq_cst);
+        auto bottom = m_bottom.load(std::memory_order::acquire);
+
+        if (top >= bottom) {
+            return std::nullopt;
+        }
+
+        // read before claiming: once top moves the owner may overwrite the slot
+        auto value = m_ring.load(std::memory_order::acquire)->load(top);
+        if (not m_top.compare_exchange_strong(top, top + 1, std::memory_order::seq_cst, std::memory_order::relaxed)) {
+            return std::nullopt;
+        }
+
+        return value;
+    }
+
+    template <StealableElement T>
+    std::size_t WorkStealingDeque<T>::size() const noexcept
+    {
+        // bottom first: top is only ever moving forward, bottom may be one below top while the owner pops
+        auto bottom = m_bottom.load(std::memory_order::acquire);
+        auto top    = m_top.load(std::memory_order::acquire);
+
+        return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+    }
+
+    template <StealableElement T>
+    auto WorkStealingDeque<T>::grow(Ring* ring, Index top, Index bottom) -> Ring*
+    {
+        auto grown = std::make_unique<Ring>(ring->capacity() * 2);
+        for (auto index = top; index != bottom; ++index) {
+            grown->store(index, ring->load(index));
+        }
+
+        // the thieves may still read from the old ring: keep it, it will never be written to again
+        auto* published = m_rings.emplace_back(std::move(grown)).get();
+        m_ring.store(published, std::memory_order::release);
+
+        return published;
+    }
+}
+
+#endif /* end of include guard: CIRCBUF_WORK_STEALING_DEQUE_HPP */
@@ -0,0 +1,165 @@
+#include "test_util.hpp"
+
+#include <circbuf/algorithm.hpp>
+#include <circbuf/circbuf.hpp>
+
+#include <boost/ut.hpp>
+#include <fmt/core.h>
+
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <vector>
+
+namespace ut = boost::ut;
+namespace rr = std::ranges;
+namespace rv = rr::views;
+
+using test_util::populate_container;
+
+static_assert(circbuf::SegmentedIterator<circbuf::CircBuf<int>::iterator>);
+static_assert(circbuf::SegmentedIterator<circbuf::CircBuf<int>::const_iterator>);
+static_assert(circbuf::SegmentedIterator<circbuf::StaticCircBuf<int, 8>::iterator>);
+static_assert(circbuf::SegmentedIterator<circbuf::CircBuf<int>::UncheckedIterator<false>>);
+static_assert(circbuf::SegmentedIterator<circbuf::CircBuf<int>::UncheckedIterator<true>>);
+static_assert(not circbuf::SegmentedIterator<std::vector<int>::iterator>);
+
+// 10 elements: [5, 15) with the head in the middle of the underlying buffer
+circbuf::CircBuf<int> make_wrapped()
+{
+    auto buffer = circbuf::CircBuf<int>{ 12 };
+    populate_container(buffer, rv::iota(0, 15));
+    buffer.pop_front();
+    buffer.pop_front();
+    return buffer;
+}
+
+int main()
+{
+    using namespace ut::operators;
+    using namespace ut::literals;
+    using ut::expect, ut::that;
+
+    "segments of an iterator pair should cover exactly the elements in between"_test = [] {
+        auto buffer = make_wrapped();
+
+        auto [head, tail] = segments(buffer.begin(), buffer.end());
+        expect(head.size() == 7_u and tail.size() == 3_u);
+        expect(rr::equal(head, rv::iota(5, 12)));
+        expect(rr::equal(tail, rv::iota(12, 15)));
+
+        auto inner = segments(buffer.begin() + 2, buffer.end() - 5);
+        expect(rr::equal(inner.first, rv::iota(7, 10)) and inner.second.empty());
+
+        auto across = segments(buffer.begin() + 6, buffer.begin() + 9);
+        expect(rr::equal(across.first, std::vector{ 11 }));
+        expect(rr::equal(across.second, std::vector{ 12, 13 }));
+
+        auto past = segments(buffer.begin() + 8, buffer.end());
+        expect(past.first.data() == &buffer.at(8) and rr::equal(past.first, std::vector{ 13, 14 }));
+        expect(past.second.empty());
+
+        expect(segments(buffer.end(), buffer.end()).empty());
+        expect(segments(buffer.begin() + 4, buffer.begin() + 4).empty());
+
+        auto empty = circbuf::CircBuf<int>{};
+        expect(segments(empty.begin(), empty.end()).empty());
+    };
+
+    "segments of an unchecked iterator pair should match the checked one"_test = [] {
+        using Unchecked = circbuf::CircBuf<int>::UncheckedIterator<false>;
+
+        auto buffer = make_wrapped();
+        for (auto first : rv::iota(std::size_t{ 0 }, buffer.size() + 1)) {
+            for (auto last : rv::iota(first, buffer.size() + 1)) {
+                auto checked   = segments(buffer.begin() + first, buffer.begin() + last);
+                auto unchecked = segments(Unchecked{ &buffer, first }, Unchecked{ &buffer, last });
+
+                expect(checked.first.size() == unchecked.first.size());
+                expect(checked.second.size() == unchecked.second.size());
+                expect(checked.empty() or checked.first.data() == unchecked.first.data());
+            }
+        }
+    };
+
+    "copy should copy the elements in order"_test = [] {
+        auto buffer = make_wrapped();
+
+        auto out = std::vector<int>(10);
+        expect(circbuf::copy(buffer, out.begin()) == out.end());
+        expect(rr::equal(out, rv::iota(5, 15)));
+
+        out.clear();
+        circbuf::copy(buffer.begin() + 5, buffer.end() - 1, std::back_inserter(out));
+        expect(rr::equal(out, rv::iota(10, 14)));
+
+        const auto& cref = buffer;
+        out.clear();
+        circbuf::copy(cref, std::back_inserter(out));
+        expect(rr::equal(out, rv::iota(5, 15)));
+    };
+
+    "fill should assign to every element in the range"_test = [] {
+        auto buffer = make_wrapped();
+
+        circbuf::fill(buffer.begin() + 1, buffer.end() - 1, 0);
+        expect(rr::equal(buffer, std::vector{ 5, 0, 0, 0, 0, 0, 0, 0, 0, 14 }));
+
+        circbuf::fill(buffer, 42);
+        expect(rr::all_of(buffer, [](int v) { return v == 42; }));
+        expect(buffer.size() == 10_u);
+    };
+
+    "find should return an iterator to the first match or last"_test = [] {
+        auto buffer = make_wrapped();
+
+        for (auto value : rv::iota(5, 15)) {
+            auto found = circbuf::find(buffer, value);
+            expect(found != buffer.end() and *found == value);
+            expect(that % (found - buffer.begin()) == value - 5);
+        }
+        expect(circbuf::find(buffer, 42) == buffer.end());
+        expect(circbuf::find(buffer.begin() + 8, buffer.end(), 5) == buffer.end());
+        expect(circbuf::find(buffer.begin(), buffer.begin() + 8, 14) == buffer.begin() + 8);
+    };
+
+    "for_each and accumulate should visit the elements in order"_test = [] {
+        auto buffer = make_wrapped();
+
+        auto visited = std::vector<int>{};
+        circbuf::for_each(buffer, [&](int v) { visited.push_back(v); });
+        expect(rr::equal(visited, rv::iota(5, 15)));
+
+        circbuf::for_each(buffer, [](int& v) { v *= 2; });
+        expect(rr::equal(buffer, rv::iota(5, 15) | rv::transform([](int v) { return v * 2; })));
+
+        expect(circbuf::accumulate(buffer, 0) == 190_i);
+        expect(circbuf::accumulate(buffer.begin(), buffer.begin() + 3, 0) == 36_i);
+
+        auto concat = circbuf::accumulate(buffer, std::string{}, [](std::string acc, int v) {
+            return std::move(acc) + std::to_string(v) + ',';
+        });
+        expect(concat == "10,12,14,16,18,20,22,24,26,28,");
+    };
+
+    "StaticCircBuf should dispatch on the segmented iterator too"_test = [] {
+        auto buffer = circbuf::StaticCircBuf<int, 12>{};
+        for (auto i : rv::iota(0, 15)) {
+            buffer.push_back(i);
+        }
+
+        expect(circbuf::accumulate(buffer, 0) == std::accumulate(buffer.begin(), buffer.end(), 0));
+        expect(*circbuf::find(buffer, 3) == 3_i);
+    };
+
+    "non segmented iterators should be forwarded to the std algorithms"_test = [] {
+        auto values = std::vector<int>(10);
+        circbuf::fill(values, 3);
+        expect(circbuf::accumulate(values, 0) == 30_i);
+        expect(circbuf::find(values, 4) == values.end());
+
+        auto out = std::vector<int>{};
+        circbuf::copy(rv::iota(0, 5), std::back_inserter(out));
+        expect(rr::equal(out, rv::iota(0, 5)));
+    };
+}
@@ -0,0 +1,178 @@
+#include <circbuf/circbuf.hpp>
+
+#include <boost/ut.hpp>
+
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <ranges>
+#include <string>
+#include <vector>
+
+namespace ut = boost::ut;
+namespace rr = std::ranges;
+namespace rv = rr::views;
+
+// counts the bytes currently allocated through it
+class CountingResource : public std::pmr::memory_resource
+{
+public:
+    std::size_t m_allocated = 0;
+
+private:
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        m_allocated += bytes;
+        return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+
+    void do_deallocate(void* ptr, std::size_t bytes, std::size_t alignment) override
+    {
+        m_allocated -= bytes;
+        std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// stateful allocator that propagates on copy, move and swap
+template <typename T>
+struct TaggedAllocator
+{
+    using value_type = T;
+
+    using propagate_on_container_copy_assignment = std::true_type;
+    using propagate_on_container_move_assignment = std::true_type;
+    using propagate_on_container_swap            = std::true_type;
+
+    int m_tag = 0;
+
+    TaggedAllocator() = default;
+    explicit TaggedAllocator(int tag)
+        : m_tag{ tag }
+    {
+    }
+
+    template <typename U>
+    TaggedAllocator(const TaggedAllocator<U>& other)
+        : m_tag{ other.m_tag }
+    {
+    }
+
+    T*   allocate(std::size_t n) { return std::allocator<T>{}.allocate(n); }
+    void deallocate(T* ptr, std::size_t n) { std::allocator<T>{}.deallocate(ptr, n); }
+
+    bool operator==(const TaggedAllocator&) const = default;
+};
+
+int main()
+{
+    using namespace ut::operators;
+    using namespace ut::literals;
+    using ut::expect, ut::that;
+
+    "memory should come from the memory resource"_test = [] {
+        auto arena    = std::array<std::byte, 1024>{};
+        auto resource = std::pmr::monotonic_buffer_resource{ arena.data(), arena.size() };
+
+        auto buffer = circbuf::pmr::CircBuf<int>{ 16, &resource };
+        for (auto i : rv::iota(0, 20)) {
+            buffer.push_back(i);
+        }
+
+        auto* first = reinterpret_cast<std::byte*>(buffer.segments().second.data());
+        expect(first >= arena.data() and first < arena.data() + arena.size());
+        expect(buffer.get_allocator().resource() == &resource);
+        expect(rr::equal(buffer, rv::iota(4, 20)));
+
+        buffer.resize(32);
+        expect(buffer.get_allocator().resource() == &resource) << "resize should keep the allocator";
+        expect(rr::equal(buffer, rv::iota(4, 20)));
+    };
+
+    "elements should be constructed with the allocator of the buffer"_test = [] {
+        auto resource = CountingResource{};
+        auto buffer   = circbuf::pmr::CircBuf<std::pmr::string>{ 4, &resource };
+
+        auto used = resource.m_allocated;
+        buffer.push_back(std::pmr::string{ "long enough to not fit in the small string buffer" });
+        buffer.emplace_back("also long enough to not fit in the small string buffer");
+
+        expect(buffer.front().get_allocator().resource() == &resource);
+        expect(buffer.back().get_allocator().resource() == &resource);
+        expect(that % resource.m_allocated > used);
+
+        buffer.clear();
+        expect(that % resource.m_allocated == used);
+    };
+
+    "move should take the storage only when the allocators compare equal"_test = [] {
+        auto resource = CountingResource{};
+        auto other    = CountingResource{};
+
+        auto source = circbuf::pmr::CircBuf<int>{ 8, &resource };
+        for (auto i : rv::iota(0, 10)) {
+            source.push_back(i);
+        }
+        auto* data = source.segments().first.data();
+
+        auto same = circbuf::pmr::CircBuf<int>{ 2, &resource };
+        same      = std::move(source);
+        expect(same.segments().first.data() == data) << "storage should be taken";
+        expect(rr::equal(same, rv::iota(2, 10)));
+
+        auto different = circbuf::pmr::CircBuf<int>{ &other };
+        different      = std::move(same);
+        expect(different.get_allocator().resource() == &other);
+        expect(different.segments().first.data() != data) << "elements should be moved into a new storage";
+        expect(rr::equal(different, rv::iota(2, 10)));
+        expect(same.empty());
+
+        auto extended = circbuf::pmr::CircBuf<int>{ std::move(different), &resource };
+        expect(extended.get_allocator().resource() == &resource);
+        expect(rr::equal(extended, rv::iota(2, 10)));
+
+        auto copy = circbuf::pmr::CircBuf<int>{ extended, &other };
+        expect(copy.get_allocator().resource() == &other);
+        expect(rr::equal(copy, extended));
+    };
+
+    "allocators should propagate according to their traits"_test = [] {
+        using Buffer = circbuf::AllocatorCircBuf<int, TaggedAllocator<int>>;
+
+        auto lhs = Buffer{ 4, TaggedAllocator<int>{ 1 } };
+        auto rhs = Buffer{ 8, TaggedAllocator<int>{ 2 } };
+        rhs.push_back(42);
+
+        lhs = rhs;
+        expect(lhs.get_allocator().m_tag == 2_i) << "should propagate on copy assignment";
+        expect(lhs.front() == 42_i);
+
+        auto other = Buffer{ 4, TaggedAllocator<int>{ 3 } };
+        other.swap(lhs);
+        expect(other.get_allocator().m_tag == 2_i and lhs.get_allocator().m_tag == 3_i);
+        expect(other.front() == 42_i and lhs.empty());
+
+        lhs = std::move(other);
+        expect(lhs.get_allocator().m_tag == 2_i) << "should propagate on move assignment";
+        expect(lhs.front() == 42_i);
+
+        // pmr allocators don't propagate on copy assignment
+        auto resource = CountingResource{};
+        auto source   = circbuf::pmr::CircBuf<int>{ 4 };
+        auto copy     = circbuf::pmr::CircBuf<int>{ 4, &resource };
+        copy          = source;
+        expect(copy.get_allocator().resource() == &resource);
+    };
+
+    "buffers in a pmr container should use the allocator of the container"_test = [] {
+        auto resource = CountingResource{};
+        auto buffers  = std::pmr::vector<circbuf::pmr::CircBuf<int>>{ &resource };
+
+        buffers.emplace_back(8);
+        buffers.emplace_back(16);
+        expect(buffers[0].get_allocator().resource() == &resource);
+        expect(buffers[1].get_allocator().resource() == &resource);
+        expect(buffers[1].capacity() == 16_u);
+    };
+}
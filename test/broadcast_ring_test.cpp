@@ -0,0 +1,226 @@
+#include "test_util.hpp"
+
+#include <circbuf/broadcast_ring.hpp>
+
+#include <boost/ut.hpp>
+#include <fmt/core.h>
+
+#include <array>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+namespace ut = boost::ut;
+namespace rr = std::ranges;
+namespace rv = rr::views;
+
+using circbuf::CursorPolicy;
+
+template <test_util::TestClass Type>
+void test()
+{
+    using namespace ut::operators;
+    using namespace ut::literals;
+    using ut::expect, ut::that, ut::throws;
+
+    Type::reset_active_instance_count();
+
+    "capacity should be rounded up to the next power of two"_test = [] {
+        expect(circbuf::BroadcastRing<Type>{ 1, { CursorPolicy::Gating } }.capacity() == 1_u);
+        expect(circbuf::BroadcastRing<Type>{ 10, { CursorPolicy::Gating } }.capacity() == 16_u);
+        expect(circbuf::BroadcastRing<Type>{ 16, {} }.capacity() == 16_u);
+
+        using circbuf::error::ZeroCapacity;
+        expect(throws<ZeroCapacity>([] { circbuf::BroadcastRing<Type>{ 0, {} }; })) << "zero capacity";
+
+        using circbuf::error::InvalidPolicy;
+        expect(throws<InvalidPolicy>([] { circbuf::BroadcastRing<Type>{ 4, { CursorPolicy::Lossy } }; }))
+            << "a Lossy consumer can't read a non trivially copyable element";
+    };
+
+    "every consumer should see every element in place"_test = [] {
+        auto ring = circbuf::BroadcastRing<Type>{ 8, { CursorPolicy::Gating, CursorPolicy::Gating } };
+        expect(ring.consumers() == 2_u);
+
+        for (auto i : rv::iota(0, 6)) {
+            expect(ring.try_push(i));
+        }
+
+        auto first = ring.peek(0);
+        expect(first.size() == 6_u and first.second.empty());
+        expect(rr::equal(first.first | rv::transform(&Type::value), rv::iota(0, 6)));
+        ring.consume(0, 4);
+        expect(ring.available(0) == 2_u and ring.available(1) == 6_u);
+
+        // wraps around for the first consumer, the second one still holds the producer back
+        for (auto i : rv::iota(6, 8)) {
+            ring.push(i);
+        }
+        expect(not ring.try_push(8)) << "the slowest consumer is capacity() elements behind";
+
+        ring.consume(1, 6);
+        for (auto i : rv::iota(8, 12)) {
+            expect(ring.try_push(i));
+        }
+
+        auto segments = ring.peek(0);
+        expect(segments.first.size() == 4_u and segments.second.size() == 4_u);
+        expect(rr::equal(segments.first | rv::transform(&Type::value), rv::iota(4, 8)));
+        expect(rr::equal(segments.second | rv::transform(&Type::value), rv::iota(8, 12)));
+        expect(throws([&] { ring.consume(0, 9); })) << "can't consume more than published";
+
+        for (const auto& value : segments.first) {
+            expect(value.stat().nocopy()) << "elements should never be copied per consumer";
+        }
+    };
+
+    "overwritten and remaining elements should be destroyed"_test = [] {
+        {
+            auto ring = circbuf::BroadcastRing<Type>{ 4, {} };
+            for (auto i : rv::iota(0, 10)) {
+                expect(ring.try_emplace(i)) << "no Gating consumer to hold the producer back";
+            }
+            expect(that % Type::active_instance_count() == 4);
+        }
+        expect(Type::active_instance_count() == 0_i);
+    };
+
+    "unbalanced constructor/destructor means there is a bug in the code"_test = [] {
+        expect(Type::active_instance_count() == 0_i) << "Unbalanced ctor/dtor detected!";
+    };
+}
+
+int main()
+{
+    test_util::for_each_tuple<test_util::NonTrivialPermutations>([]<typename T>() {
+        if constexpr (circbuf::ConcurrentElement<T>) {
+            test<T>();
+        }
+    });
+
+    using namespace ut::operators;
+    using namespace ut::literals;
+    using ut::expect, ut::that;
+
+    "read should copy the elements in batch and count what a Lossy consumer missed"_test = [] {
+        auto ring = circbuf::BroadcastRing<int>{ 4, { CursorPolicy::Gating, CursorPolicy::Lossy } };
+        auto out  = std::array<int, 8>{};
+
+        for (auto i : rv::iota(0, 4)) {
+            ring.push(i);
+        }
+        expect(ring.read(0, std::span{ out }.first(3)) == 3_u);
+        expect(rr::equal(std::span{ out }.first(3), rv::iota(0, 3)));
+        ring.push(4);
+        ring.push(5);
+        ring.push(6);
+        expect(not ring.try_push(7));
+
+        expect(ring.read(1, out) == 4_u) << "only the last capacity() elements are still there";
+        expect(rr::equal(std::span{ out }.first(4), rv::iota(3, 7)));
+        expect(ring.lost(1) == 3_u);
+
+        expect(ring.read(0, out) == 4_u);
+        expect(rr::equal(std::span{ out }.first(4), rv::iota(3, 7)));
+        expect(ring.lost(0) == 0_u);
+        expect(ring.read(0, out) == 0_u);
+    };
+
+    "a Lossy consumer should not be able to peek or consume in place"_test = [] {
+        auto ring = circbuf::BroadcastRing<int>{ 4, { CursorPolicy::Lossy } };
+        for (auto i : rv::iota(0, 3)) {
+            ring.push(i);
+        }
+
+        auto segments = ring.peek(0);
+        expect(segments.first.empty() and segments.second.empty());
+        expect(ut::throws<circbuf::error::InvalidPolicy>([&] { ring.consume(0, 1); }));
+        expect(ring.available(0) == 3_u) << "the cursor should not have moved";
+    };
+
+    "values should be broadcast in order to every consumer between threads"_test = [] {
+        constexpr auto count = 200'000;
+
+        auto ring = circbuf::BroadcastRing<int>{
+            64,
+            { CursorPolicy::Gating, CursorPolicy::Gating, CursorPolicy::Lossy },
+        };
+        auto done = std::atomic<bool>{ false };
+
+        auto peeked = std::vector<int>{};
+        auto copied = std::vector<int>{};
+        auto lossy  = std::vector<int>{};
+        {
+            auto threads = std::vector<std::jthread>{};
+
+            threads.emplace_back([&] {
+                while (peeked.size() < count) {
+                    auto segments = ring.peek(0);
+                    peeked.insert(peeked.end(), segments.first.begin(), segments.first.end());
+                    peeked.insert(peeked.end(), segments.second.begin(), segments.second.end());
+                    ring.consume(0, segments.size());
+                }
+            });
+
+            threads.emplace_back([&] {
+                auto out = std::array<int, 16>{};
+                while (copied.size() < count) {
+                    auto n = ring.read(1, out);
+                    copied.insert(copied.end(), out.begin(), out.begin() + static_cast<std::ptrdiff_t>(n));
+                }
+            });
+
+            threads.emplace_back([&] {
+                auto out = std::array<int, 16>{};
+                while (not done.load() or ring.available(2) > 0) {
+                    auto n = ring.read(2, out);
+                    lossy.insert(lossy.end(), out.begin(), out.begin() + static_cast<std::ptrdiff_t>(n));
+                }
+            });
+
+            for (auto i : rv::iota(0, count)) {
+                ring.push(i);
+            }
+            done.store(true);
+        }
+
+        expect(rr::equal(peeked, rv::iota(0, count)));
+        expect(rr::equal(copied, rv::iota(0, count)));
+
+        expect(rr::is_sorted(lossy) and rr::adjacent_find(lossy) == lossy.end());
+        expect(that % lossy.size() + ring.lost(2) == count) << "every value is either read or counted as lost";
+    };
+
+    "consumers should sleep until published and the producer until consumed with ParkWait"_test = [] {
+        constexpr auto count = 20'000;
+
+        using Ring = circbuf::BroadcastRing<int, circbuf::ParkWait>;
+
+        auto ring     = Ring{ 8, { CursorPolicy::Gating, CursorPolicy::Gating } };
+        auto received = std::array<std::vector<int>, 2>{};
+        {
+            auto threads = std::vector<std::jthread>{};
+
+            for (auto c : rv::iota(std::size_t{ 0 }, received.size())) {
+                threads.emplace_back([&, c] {
+                    while (received[c].size() < count) {
+                        ring.wait(c);
+
+                        auto segments = ring.peek(c);
+                        received[c].insert(received[c].end(), segments.first.begin(), segments.first.end());
+                        received[c].insert(received[c].end(), segments.second.begin(), segments.second.end());
+                        ring.consume(c, segments.size());
+                    }
+                });
+            }
+
+            for (auto i : rv::iota(0, count)) {
+                ring.push(i);
+            }
+        }
+
+        for (const auto& values : received) {
+            expect(rr::equal(values, rv::iota(0, count)));
+        }
+    };
+}
@@ -8,6 +8,7 @@
 #include <fmt/std.h>
 
 #include <cassert>
+#include <memory>
 #include <ranges>
 #include <concepts>
 #include <vector>
@@ -48,6 +49,44 @@ void test()
 
         using ConstIter = circbuf::CircBuf<Type>::template Iterator<true>;
         static_assert(std::random_access_iterator<ConstIter>);
+
+        using UncheckedIter = circbuf::CircBuf<Type>::template UncheckedIterator<false>;
+        static_assert(std::random_access_iterator<UncheckedIter>);
+
+        using UncheckedConstIter = circbuf::CircBuf<Type>::template UncheckedIterator<true>;
+        static_assert(std::random_access_iterator<UncheckedConstIter>);
+        static_assert(std::convertible_to<UncheckedIter, UncheckedConstIter>);
+    };
+
+    "iterator arithmetic should follow the logical order across the wrap around"_test = [] {
+        auto buffer = circbuf::CircBuf<Type>{ 10 };
+        populate_container(buffer, rv::iota(0, 16));    // full, head in the middle of the buffer
+
+        expect(buffer.begin() != buffer.end());
+        expect(buffer.cend() - buffer.cbegin() == 10_i);
+
+        auto it = buffer.begin();
+        for (auto i : rv::iota(0, 10)) {
+            expect(that % it->value() == i + 6);
+            expect(that % it[0].value() == buffer.at(static_cast<std::size_t>(i)).value());
+            ++it;
+        }
+        expect(it == buffer.end());
+
+        for (auto i : rv::iota(0, 10) | rv::reverse) {
+            expect(that % (--it)->value() == i + 6);
+        }
+        expect(it == buffer.begin());
+
+        expect(that % (buffer.begin() + 7)->value() == 13);
+        expect(that % (buffer.end() - 7)->value() == 9);
+        expect((buffer.begin() + 4) - (buffer.end() - 3) == -3_i);
+        expect(buffer.begin() + 10 == buffer.end());
+        expect(buffer.begin() + 3 < buffer.begin() + 5);
+
+        const auto& cref = buffer;
+        auto        cit  = typename circbuf::CircBuf<Type>::const_iterator{ buffer.begin() + 2 };
+        expect(cit == cref.begin() + 2);
     };
 
     "push_back should add an element to the back"_test = [](circbuf::BufferPolicy policy) {
@@ -267,6 +306,123 @@ void test()
         }
     };
 
+    "insertion and removal should only shift the elements on the shorter side"_test = [] {
+        auto buffer = circbuf::CircBuf<Type>{ 16 };
+        populate_container(buffer, rv::iota(0, 20));
+        for (auto _ : rv::iota(0, 6)) {
+            buffer.pop_front();
+        }
+
+        auto back = &buffer.back();
+        buffer.insert(2, -1);
+        expect(&buffer.back() == back) << "front half: the elements after pos should not move";
+        expect(equal_underlying<Type>(buffer, std::vector{ 10, 11, -1, 12, 13, 14, 15, 16, 17, 18, 19 }));
+
+        auto front = &buffer.front();
+        buffer.insert(9, -2);
+        expect(&buffer.front() == front) << "back half: the elements before pos should not move";
+        expect(equal_underlying<Type>(buffer, std::vector{ 10, 11, -1, 12, 13, 14, 15, 16, 17, -2, 18, 19 }));
+
+        back = &buffer.back();
+        expect(buffer.remove(3).value() == 12_i);
+        expect(&buffer.back() == back) << "front half: the elements after pos should not move";
+
+        front = &buffer.front();
+        expect(buffer.remove(8).value() == -2_i);
+        expect(&buffer.front() == front) << "back half: the elements before pos should not move";
+        expect(equal_underlying<Type>(buffer, std::vector{ 10, 11, -1, 13, 14, 15, 16, 17, 18, 19 }));
+
+        expect(buffer.remove(0).value() == 10_i);
+        expect(buffer.remove(buffer.size() - 1).value() == 19_i);
+        expect(equal_underlying<Type>(buffer, std::vector{ 11, -1, 13, 14, 15, 16, 17, 18 }));
+    };
+
+    "insert_range should insert the whole range at any position across the wrap around"_test = [] {
+        for (auto pos : rv::iota(std::size_t{ 0 }, std::size_t{ 7 })) {
+            for (auto count : rv::iota(0, 4)) {
+                auto buffer = circbuf::CircBuf<Type>{ 10, circbuf::BufferPolicy::ThrowOnFull };
+                populate_container(buffer, rv::iota(0, 8));
+                for (auto _ : rv::iota(0, 7)) {
+                    buffer.pop_front();
+                }
+                populate_container(buffer, rv::iota(8, 14));    // [7, 14) with the head near the end
+
+                auto expected = std::vector<int>{};
+                auto range    = rv::iota(100, 100 + count);
+                rr::copy(rv::iota(7, 14), std::back_inserter(expected));
+                expected.insert(expected.begin() + static_cast<long>(pos), range.begin(), range.end());
+
+                buffer.insert_range(pos, range);
+                expect(equal_underlying<Type>(buffer, expected)) << "pos:" << pos << "count:" << count;
+            }
+        }
+    };
+
+    "insert_range with ReplaceOnFull policy should trim the result to the capacity"_test = [] {
+        using circbuf::BufferInsertPolicy;
+
+        for (auto policy : { BufferInsertPolicy::DiscardHead, BufferInsertPolicy::DiscardTail }) {
+            for (auto pos : rv::iota(std::size_t{ 0 }, std::size_t{ 8 })) {
+                for (auto count : rv::iota(1, 13)) {
+                    auto buffer = circbuf::CircBuf<Type>{ 10 };
+                    populate_container(buffer, rv::iota(0, 12));
+                    buffer.pop_back();
+                    buffer.pop_back();
+                    buffer.pop_back();    // [2, 9) with the head in the middle
+
+                    auto expected = std::vector<int>{};
+                    rr::copy(rv::iota(2, 9), std::back_inserter(expected));
+                    auto range = rv::iota(100, 100 + count);
+                    expected.insert(expected.begin() + static_cast<long>(pos), range.begin(), range.end());
+                    if (expected.size() > 10 and policy == BufferInsertPolicy::DiscardHead) {
+                        expected.erase(expected.begin(), expected.end() - 10);
+                    } else if (expected.size() > 10) {
+                        expected.erase(expected.begin() + 10, expected.end());
+                    }
+
+                    buffer.insert_range(pos, range, policy);
+                    expect(equal_underlying<Type>(buffer, expected)) << "pos:" << pos << "count:" << count;
+                }
+            }
+        }
+
+        auto buffer = circbuf::CircBuf<Type>{ 10, circbuf::BufferPolicy::ThrowOnFull };
+        populate_container(buffer, rv::iota(0, 7));
+        expect(throws([&] { buffer.insert_range(3, rv::iota(0, 4)); })) << "range doesn't fit";
+        expect(throws([&] { buffer.insert_range(8, rv::iota(0, 1)); })) << "position out of range";
+        expect(equal_underlying<Type>(buffer, rv::iota(0, 7)));
+    };
+
+    "erase should remove the elements in the range at any position across the wrap around"_test = [] {
+        for (auto first : rv::iota(std::size_t{ 0 }, std::size_t{ 9 })) {
+            for (auto last : rv::iota(first, std::size_t{ 9 })) {
+                auto buffer = circbuf::CircBuf<Type>{ 10 };
+                populate_container(buffer, rv::iota(0, 15));
+                buffer.pop_front();
+                buffer.pop_back();    // [6, 14) with the head in the middle
+
+                auto expected = std::vector<int>{};
+                rr::copy(rv::iota(6, 14), std::back_inserter(expected));
+                expected.erase(
+                    expected.begin() + static_cast<long>(first), expected.begin() + static_cast<long>(last)
+                );
+
+                buffer.erase(first, last);
+                expect(equal_underlying<Type>(buffer, expected)) << "first:" << first << "last:" << last;
+            }
+        }
+
+        auto buffer = circbuf::CircBuf<Type>{ 10 };
+        populate_container(buffer, rv::iota(0, 5));
+        expect(throws([&] { buffer.erase(3, 2); })) << "first is after last";
+        expect(throws([&] { buffer.erase(3, 6); })) << "last is past the end";
+
+        buffer.erase(0, 5);
+        expect(buffer.empty());
+        buffer.push_back(42);
+        expect(buffer.front().value() == 42_i);
+    };
+
     "removal should be able to remove value anywhere in the buffer"_test = [] {
         auto buffer = circbuf::CircBuf<Type>{ 10 };    // default policy
         populate_container(buffer, rv::iota(0, 15));
@@ -291,6 +447,191 @@ void test()
         expect(equal_underlying<Type>(buffer, expected));
     };
 
+    "try_* functions should report the error instead of throwing"_test = [] {
+        using circbuf::error::Code;
+
+        auto zero = circbuf::CircBuf<Type>{ 0 };
+        expect(zero.try_push_back(42) == Code::ZeroCapacity);
+        expect(zero.try_push_front(42) == Code::ZeroCapacity);
+
+        auto buffer = circbuf::CircBuf<Type>{ 5, circbuf::BufferPolicy::ThrowOnFull };
+        expect(not buffer.try_pop_front().has_value());
+        expect(not buffer.try_pop_back().has_value());
+        expect(not buffer.try_remove(0).has_value());
+        expect(buffer.try_front() == nullptr and buffer.try_back() == nullptr and buffer.try_at(0) == nullptr);
+
+        for (auto i : rv::iota(1, 4)) {
+            expect(buffer.try_push_back(i) == Code::None);
+        }
+        expect(buffer.try_push_front(0) == Code::None);
+        expect(buffer.try_insert(5, 42) == Code::OutOfRange);
+        expect(buffer.try_insert(4, 4) == Code::None);
+        expect(equal_underlying<Type>(buffer, rv::iota(0, 5)));
+
+        expect(buffer.try_push_back(42) == Code::BufferFull);
+        expect(buffer.try_push_front(42) == Code::BufferFull);
+        expect(buffer.try_insert(2, 42) == Code::BufferFull);
+        expect(equal_underlying<Type>(buffer, rv::iota(0, 5)));
+
+        // same error as the throwing functions when more than one precondition fails
+        using circbuf::error::OutOfRange, circbuf::error::ZeroCapacity;
+        expect(buffer.try_insert(6, 42) == Code::OutOfRange);
+        expect(throws<OutOfRange>([&] { buffer.insert(6, 42); }));
+        expect(zero.try_insert(1, 42) == Code::ZeroCapacity);
+        expect(throws<ZeroCapacity>([&] { zero.insert(1, 42); }));
+
+        expect(that % buffer.try_front()->value() == 0);
+        expect(that % buffer.try_back()->value() == 4);
+        expect(that % buffer.try_at(3)->value() == 3);
+        expect(buffer.try_at(5) == nullptr);
+
+        auto value = buffer.try_remove(2);
+        expect(value.has_value() and value->value() == 2);
+        value = buffer.try_pop_front();
+        expect(value.has_value() and value->value() == 0);
+        value = buffer.try_pop_back();
+        expect(value.has_value() and value->value() == 4);
+        expect(equal_underlying<Type>(buffer, std::array{ 1, 3 }));
+
+        buffer.policy() = circbuf::BufferPolicy::ReplaceOnFull;
+        populate_container(buffer, rv::iota(5, 10));
+        expect(buffer.try_push_back(10) == Code::None);
+        expect(equal_underlying<Type>(buffer, rv::iota(6, 11)));
+    };
+
+    "emplace should construct the element in place without copy or move"_test = [](circbuf::BufferPolicy policy) {
+        auto buffer = circbuf::CircBuf<Type>{ 5, policy };
+
+        for (auto i : rv::iota(2, 5)) {
+            auto& value = buffer.emplace_back(i);
+            expect(that % value.value() == i);
+        }
+        for (auto i : rv::iota(0, 2) | rv::reverse) {
+            auto& value = buffer.emplace_front(i);
+            expect(that % value.value() == i);
+        }
+        expect(equal_underlying<Type>(buffer, rv::iota(0, 5)));
+
+        if (policy == circbuf::BufferPolicy::ThrowOnFull) {
+            expect(throws([&] { buffer.emplace_back(42); })) << "should throw when emplace to full buffer";
+            expect(throws([&] { buffer.emplace_front(42); })) << "should throw when emplace to full buffer";
+            expect(buffer.try_emplace_back(42) == circbuf::error::Code::BufferFull);
+        } else {
+            buffer.emplace_back(5);
+            buffer.emplace_back(6);
+            expect(equal_underlying<Type>(buffer, rv::iota(2, 7)));
+            buffer.emplace_front(1);
+            expect(equal_underlying<Type>(buffer, rv::iota(1, 6)));
+            expect(buffer.try_emplace_front(0) == circbuf::error::Code::None);
+            expect(equal_underlying<Type>(buffer, rv::iota(0, 5)));
+        }
+
+        for (const auto& value : buffer) {
+            expect(value.stat().nocopy() and value.stat().nomove()) << value.stat();
+        }
+    } | g_policy_permutations;
+
+    if constexpr (std::copy_constructible<Type>) {
+        "push from an lvalue should copy the element exactly once"_test = [] {
+            auto buffer = circbuf::CircBuf<Type>{ 2 };
+            auto value  = Type{ 42 };
+
+            expect(that % buffer.push_back(value).stat().copycount() == 1);
+            expect(that % buffer.push_front(value).stat().copycount() == 1);
+            expect(that % buffer.push_back(value).stat().copycount() == 1);    // replaces the front
+            expect(equal_underlying<Type>(buffer, std::array{ 42, 42 }));
+        };
+    }
+
+    "push_back_range should push the whole range across the wrap around"_test = [](circbuf::BufferPolicy policy) {
+        auto buffer = circbuf::CircBuf<Type>{ 10, policy };
+        populate_container(buffer, rv::iota(0, 7));
+        for (auto _ : rv::iota(0, 5)) {
+            buffer.pop_front();
+        }
+
+        buffer.push_back_range(rv::iota(7, 15));
+        expect(buffer.full());
+        expect(equal_underlying<Type>(buffer, rv::iota(5, 15)));
+
+        buffer.push_back_range(rv::iota(0, 0));
+        expect(equal_underlying<Type>(buffer, rv::iota(5, 15)));
+    } | g_policy_permutations;
+
+    "push_back_range with ReplaceOnFull policy should discard the oldest elements"_test = [] {
+        auto buffer = circbuf::CircBuf<Type>{ 10 };
+        populate_container(buffer, rv::iota(0, 6));
+
+        buffer.push_back_range(rv::iota(6, 13));
+        expect(buffer.size() == 10_u);
+        expect(equal_underlying<Type>(buffer, rv::iota(3, 13)));
+
+        buffer.push_back_range(rv::iota(100, 125));
+        expect(buffer.size() == 10_u);
+        expect(equal_underlying<Type>(buffer, rv::iota(115, 125)));
+
+        // forward range that is not sized
+        buffer.push_back_range(rv::iota(0, 10) | rv::filter([](int i) { return i % 2 == 0; }));
+        expect(equal_underlying<Type>(buffer, std::vector{ 120, 121, 122, 123, 124, 0, 2, 4, 6, 8 }));
+    };
+
+    "push_back_range with ThrowOnFull policy should throw without pushing anything"_test = [] {
+        auto buffer = circbuf::CircBuf<Type>{ 10, circbuf::BufferPolicy::ThrowOnFull };
+        populate_container(buffer, rv::iota(0, 6));
+
+        expect(throws([&] { buffer.push_back_range(rv::iota(6, 11)); })) << "range doesn't fit";
+        expect(equal_underlying<Type>(buffer, rv::iota(0, 6)));
+
+        buffer.push_back_range(rv::iota(6, 10));
+        expect(equal_underlying<Type>(buffer, rv::iota(0, 10)));
+    };
+
+    "pop_front_n should move the elements into the output span"_test = [] {
+        auto buffer = circbuf::CircBuf<Type>{ 10 };
+        populate_container(buffer, rv::iota(0, 15));
+
+        auto out = std::vector<Type>{};
+        for (auto _ : rv::iota(0, 8)) {
+            out.emplace_back(-1);
+        }
+
+        expect(buffer.pop_front_n(out) == 8_u);
+        expect(equal_underlying<Type>(out, rv::iota(5, 13)));
+        expect(equal_underlying<Type>(buffer, rv::iota(13, 15)));
+
+        expect(buffer.pop_front_n(out) == 2_u);
+        expect(equal_underlying<Type>(subrange(out, 0, 2), rv::iota(13, 15)));
+        expect(buffer.empty());
+
+        expect(buffer.pop_front_n(out) == 0_u);
+    };
+
+    "segments should view the elements in order without moving them"_test = [] {
+        auto buffer = circbuf::CircBuf<Type>{ 10 };
+        expect(buffer.segments().empty());
+
+        populate_container(buffer, rv::iota(0, 6));
+        auto [first, second] = buffer.segments();
+        expect(first.size() == 6_u and second.empty()) << "linearized buffer has a single segment";
+        expect(first.data() == buffer.data().data());
+
+        populate_container(buffer, rv::iota(6, 14));
+        buffer.pop_front();
+        expect(throws([&] { buffer.data(); })) << "neither linearized nor full";
+
+        const auto& cref     = buffer;
+        auto        segments = cref.segments();
+        expect(segments.size() == buffer.size());
+        expect(segments.first.size() == 5_u and segments.second.size() == 4_u);
+        expect(equal_underlying<Type>(segments.first, rv::iota(5, 10)));
+        expect(equal_underlying<Type>(segments.second, rv::iota(10, 14)));
+
+        for (auto& value : buffer.segments().second) {
+            value = Type{ -1 };
+        }
+        expect(equal_underlying<Type>(buffer, std::vector{ 5, 6, 7, 8, 9, -1, -1, -1, -1 }));
+    };
+
     "default initialized CircBuf is basically useless"_test = [] {
         auto buffer = circbuf::CircBuf<Type>{};
         expect(buffer.size() == 0_i);
@@ -417,11 +758,481 @@ void test()
         };
     }
 
+    "PowerOfTwo capacity policy should round the capacity up to the next power of two"_test = [] {
+        using Pow2CircBuf = circbuf::CircBuf<Type, circbuf::BufferCapacityPolicy::PowerOfTwo>;
+
+        expect(Pow2CircBuf{ 0 }.capacity() == 0_u);
+        expect(Pow2CircBuf{ 1 }.capacity() == 1_u);
+        expect(Pow2CircBuf{ 10 }.capacity() == 16_u);
+        expect(Pow2CircBuf{ 16 }.capacity() == 16_u);
+
+        auto buffer = Pow2CircBuf{ 10 };
+        buffer.resize(17);
+        expect(buffer.capacity() == 32_u);
+        buffer.resize(0);
+        expect(buffer.capacity() == 0_u);
+    };
+
+    "PowerOfTwo capacity policy should wrap around the same way as Exact"_test = [] {
+        auto buffer = circbuf::CircBuf<Type, circbuf::BufferCapacityPolicy::PowerOfTwo>{ 16 };
+        for (auto i : rv::iota(0, 40)) {
+            buffer.push_back(i);
+        }
+        expect(buffer.full());
+        expect(equal_underlying<Type>(buffer, rv::iota(24, 40)));
+
+        for (auto _ : rv::iota(0, 4)) {
+            buffer.pop_front();
+        }
+        buffer.push_front(1);
+        buffer.push_front(0);
+
+        auto expected = std::vector{ 0, 1, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39 };
+        expect(equal_underlying<Type>(buffer, expected));
+
+        expect(buffer.remove(5).value() == 31_i);
+        buffer.insert(3, 42);
+        buffer.pop_back();
+
+        expected = std::vector{ 0, 1, 28, 42, 29, 30, 32, 33, 34, 35, 36, 37, 38 };
+        expect(equal_underlying<Type>(buffer, expected));
+
+        buffer.linearize();
+        expect(buffer.linearized());
+        expect(equal_underlying<Type>(buffer.data(), expected));
+    };
+
+    "linearize should keep the order for every head position and size"_test = [] {
+        for (auto head : rv::iota(0, 7)) {
+            for (auto size : rv::iota(1, 8)) {
+                auto buffer = circbuf::CircBuf<Type>{ 7 };
+                for (auto _ : rv::iota(0, head)) {
+                    buffer.push_back(-1);
+                }
+                buffer.push_back(0);
+                for (auto _ : rv::iota(0, head)) {
+                    buffer.pop_front();    // not emptied, the head stays where it is
+                }
+                populate_container(buffer, rv::iota(1, size));
+
+                buffer.linearize();
+                expect(buffer.linearized() and equal_underlying<Type>(buffer.data(), rv::iota(0, size)))
+                    << "head:" << head << "size:" << size;
+            }
+        }
+    };
+
+    "StaticCircBuf should store the elements inline with a compile-time capacity"_test = [] {
+        using Buffer = circbuf::StaticCircBuf<Type, 10>;
+        static_assert(Buffer::static_capacity);
+        static_assert(Buffer::capacity_policy == circbuf::BufferCapacityPolicy::Exact);
+        static_assert(sizeof(Buffer) >= 10 * sizeof(Type));
+
+        using Pow2Buffer = circbuf::StaticCircBuf<Type, 16>;
+        static_assert(Pow2Buffer::capacity_policy == circbuf::BufferCapacityPolicy::PowerOfTwo);
+
+        auto buffer = Buffer{};
+        expect(buffer.capacity() == 10_u);
+        expect(buffer.size() == 0_u);
+
+        for (auto i : rv::iota(0, 15)) {
+            buffer.push_back(i);
+        }
+        expect(buffer.full());
+        expect(equal_underlying<Type>(buffer, rv::iota(5, 15)));
+
+        buffer.pop_front();
+        buffer.push_front(-1);
+        expect(buffer.front().value() == -1_i);
+        expect(equal_underlying<Type>(subrange(buffer, 1, 10), rv::iota(6, 15)));
+
+        auto throwing = Buffer{ circbuf::BufferPolicy::ThrowOnFull };
+        for (auto i : rv::iota(0, 10)) {
+            throwing.push_back(i);
+        }
+        expect(throws([&] { throwing.push_back(42); })) << "should throw when push to full buffer";
+    };
+
+    "StaticCircBuf move should move each element and leave the source empty"_test = [] {
+        auto buffer = circbuf::StaticCircBuf<Type, 10>{};
+        for (auto i : rv::iota(0, 13)) {
+            buffer.push_back(i);
+        }
+        buffer.pop_back();
+
+        auto moved = std::move(buffer);
+        expect(buffer.size() == 0_u);
+        expect(buffer.capacity() == 10_u);
+        expect(moved.size() == 9_u);
+        expect(equal_underlying<Type>(moved, rv::iota(3, 12)));
+
+        auto other = circbuf::StaticCircBuf<Type, 10>{};
+        other.push_back(42);
+        other.swap(moved);
+        expect(moved.size() == 1_u);
+        expect(moved.front().value() == 42_i);
+        expect(equal_underlying<Type>(other, rv::iota(3, 12)));
+
+        if constexpr (std::copyable<Type>) {
+            auto copy = other;
+            expect(rr::equal(copy, other));
+        }
+    };
+
+    "FixedPolicyCircBuf should behave like a CircBuf with the same runtime policy"_test = [] {
+        using circbuf::BufferPolicy;
+
+        using Replace = circbuf::FixedPolicyCircBuf<Type, BufferPolicy::ReplaceOnFull>;
+        using Throw   = circbuf::FixedPolicyCircBuf<Type, BufferPolicy::ThrowOnFull>;
+
+        static_assert(sizeof(Replace) < sizeof(circbuf::CircBuf<Type>));
+        static_assert(not requires (Replace buffer) { buffer.policy() = BufferPolicy::ThrowOnFull; });
+        static_assert(requires (circbuf::CircBuf<Type> buffer) { buffer.policy() = BufferPolicy::ThrowOnFull; });
+
+        auto replace = Replace{ 5 };
+        expect(replace.policy() == BufferPolicy::ReplaceOnFull);
+        for (auto i : rv::iota(0, 8)) {
+            replace.push_back(i);
+        }
+        expect(equal_underlying<Type>(replace, rv::iota(3, 8)));
+
+        auto throwing = Throw{ 5 };
+        expect(throwing.policy() == BufferPolicy::ThrowOnFull);
+        for (auto i : rv::iota(0, 5)) {
+            throwing.push_back(i);
+        }
+        expect(throws([&] { throwing.push_back(42); })) << "should throw when push to full buffer";
+        expect(throws([&] { throwing.push_back_range(rv::iota(0, 1)); })) << "should throw when push to full buffer";
+        expect(equal_underlying<Type>(throwing, rv::iota(0, 5)));
+
+        if constexpr (std::copyable<Type>) {
+            auto copy = replace.linearize_copy();
+            expect(copy.linearized() and equal_underlying<Type>(copy, rv::iota(3, 8)));
+        }
+    };
+
+    "push with GrowOnFull policy should grow the capacity by the growth factor"_test = [] {
+        auto buffer = circbuf::CircBuf<Type>{ 0, circbuf::Growth{} };
+        expect(buffer.policy() == circbuf::BufferPolicy::GrowOnFull);
+
+        auto capacities = std::vector<std::size_t>{};
+        for (auto i : rv::iota(0, 10)) {
+            buffer.push_back(i);
+            capacities.push_back(buffer.capacity());
+        }
+        expect(capacities == std::vector<std::size_t>{ 1, 2, 4, 4, 8, 8, 8, 8, 16, 16 });
+        expect(equal_underlying<Type>(buffer, rv::iota(0, 10)));
+
+        // wrapped around when growing
+        buffer.pop_front();
+        buffer.pop_front();
+        for (auto i : rv::iota(10, 18)) {
+            buffer.push_back(i);
+        }
+        expect(buffer.capacity() == 16_i);
+        buffer.push_front(1);
+        expect(buffer.capacity() == 32_i);
+        expect(equal_underlying<Type>(buffer, rv::iota(1, 18)));
+
+        buffer.emplace_front(0);
+        buffer.emplace_back(18);
+        expect(equal_underlying<Type>(buffer, rv::iota(0, 19)));
+    };
+
+    "GrowOnFull policy should throw once the buffer can't grow past max_capacity"_test = [] {
+        using circbuf::error::Code;
+
+        auto buffer = circbuf::CircBuf<Type>{ 4, circbuf::Growth{ .factor = 1.5, .max_capacity = 10 } };
+
+        auto capacities = std::vector<std::size_t>{};
+        for (auto i : rv::iota(0, 10)) {
+            buffer.push_back(i);
+            capacities.push_back(buffer.capacity());
+        }
+        expect(capacities == std::vector<std::size_t>{ 4, 4, 4, 4, 6, 6, 9, 9, 9, 10 });
+
+        expect(throws([&] { buffer.push_back(42); })) << "should throw when it can't grow anymore";
+        expect(throws([&] { buffer.push_front(42); })) << "should throw when it can't grow anymore";
+        expect(throws([&] { buffer.insert(3, 42); })) << "should throw when it can't grow anymore";
+        expect(buffer.try_push_back(42) == Code::BufferFull);
+        expect(buffer.try_emplace_front(42) == Code::BufferFull);
+        expect(buffer.try_insert(3, 42) == Code::BufferFull);
+        expect(buffer.try_insert(11, 42) == Code::OutOfRange);
+        expect(buffer.capacity() == 10_i);
+        expect(equal_underlying<Type>(buffer, rv::iota(0, 10)));
+
+        buffer.growth().max_capacity = 20;
+        expect(buffer.try_push_back(10) == Code::None);
+        expect(buffer.capacity() == 15_i);
+        expect(equal_underlying<Type>(buffer, rv::iota(0, 11)));
+    };
+
+    "GrowOnFull policy should grow once for a whole range"_test = [] {
+        auto buffer = circbuf::CircBuf<Type>{ 4, circbuf::Growth{} };
+        buffer.push_back(0);
+        buffer.push_back(9);
+
+        buffer.insert_range(1, rv::iota(1, 4));
+        expect(buffer.capacity() == 8_i);
+        buffer.insert_range(4, rv::iota(4, 9));
+        expect(buffer.capacity() == 16_i);
+        expect(equal_underlying<Type>(buffer, rv::iota(0, 10)));
+
+        buffer.push_back_range(rv::iota(10, 30));
+        expect(buffer.capacity() == 32_i);
+        expect(equal_underlying<Type>(buffer, rv::iota(0, 30)));
+
+        buffer.growth().max_capacity = 32;
+        expect(throws([&] { buffer.push_back_range(rv::iota(30, 33)); })) << "should not fit";
+        expect(throws([&] { buffer.insert_range(0, rv::iota(30, 33)); })) << "should not fit";
+        expect(equal_underlying<Type>(buffer, rv::iota(0, 30)));
+    };
+
+    if constexpr (std::copyable<Type>) {
+        "GrowOnFull policy should push a copy of an element of the buffer itself"_test = [] {
+            auto buffer = circbuf::CircBuf<Type>{ 2, circbuf::Growth{} };
+            buffer.push_back(1);
+            buffer.push_back(2);
+
+            buffer.push_back(buffer.front());
+            buffer.push_back(buffer.back());
+            buffer.push_front(buffer.back());
+            expect(buffer.capacity() == 8_i);
+            expect(equal_underlying<Type>(buffer, std::array{ 1, 1, 2, 1, 1 }));
+        };
+    }
+
+    "shrink_to_fit should release the unused capacity"_test = [] {
+        auto buffer = circbuf::CircBuf<Type>{ 0, circbuf::Growth{} };
+        populate_container(buffer, rv::iota(0, 10));
+        buffer.pop_front();
+        buffer.pop_front();
+        buffer.push_back(10);
+
+        buffer.shrink_to_fit();
+        expect(buffer.capacity() == 9_i);
+        expect(equal_underlying<Type>(buffer, rv::iota(2, 11)));
+        expect(buffer.shrink_stats().shrinks == 1_i);
+        expect(that % buffer.shrink_stats().reclaimed_bytes == 7 * sizeof(Type));
+
+        buffer.shrink_to_fit();
+        expect(buffer.shrink_stats().shrinks == 1_i) << "nothing to release";
+
+        buffer.clear();
+        buffer.shrink_to_fit();
+        expect(buffer.capacity() == 0_i);
+        buffer.push_back(42);
+        expect(equal_underlying<Type>(buffer, std::array{ 42 }));
+
+        auto rounded = circbuf::CircBuf<Type, circbuf::BufferCapacityPolicy::PowerOfTwo>{ 64 };
+        for (auto i : rv::iota(0, 20)) {
+            rounded.push_back(i);
+        }
+        rounded.shrink_to_fit();
+        expect(rounded.capacity() == 32_i);
+        expect(equal_underlying<Type>(rounded, rv::iota(0, 20)));
+    };
+
+    "GrowOnFull policy with shrink_after should halve the capacity after a burst"_test = [] {
+        auto growth = circbuf::Growth{ .shrink_after = 4, .min_capacity = 8 };
+        auto buffer = circbuf::CircBuf<Type>{ 0, growth };
+        populate_container(buffer, rv::iota(0, 64));
+        expect(buffer.capacity() == 64_i);
+
+        // below a quarter of the capacity for 4 pops in a row
+        auto capacities = std::vector<std::size_t>{};
+        for (auto i : rv::iota(0, 64)) {
+            auto value = buffer.pop_front();
+            expect(that % value.value() == i);
+            if (capacities.empty() or capacities.back() != buffer.capacity()) {
+                capacities.push_back(buffer.capacity());
+            }
+        }
+        expect(capacities == std::vector<std::size_t>{ 64, 32, 16, 8 });
+        expect(buffer.shrink_stats().shrinks == 3_i);
+        expect(that % buffer.shrink_stats().reclaimed_bytes == (32 + 16 + 8) * sizeof(Type));
+
+        // a pop that leaves the buffer at a quarter of its capacity or more resets the count
+        populate_container(buffer, rv::iota(0, 10));
+        expect(buffer.capacity() == 16_i);
+        buffer.erase(0, 6);
+        for (auto i : rv::iota(0, 20)) {
+            buffer.pop_front();    // 3 elements, below the quarter of 16
+            buffer.push_back(i);
+            buffer.push_back(i);
+            buffer.pop_front();    // back to 4
+        }
+        expect(buffer.capacity() == 16_i);
+
+        // removals count too and the survivors keep their order
+        buffer.clear();
+        populate_container(buffer, rv::iota(0, 16));
+        buffer.erase(0, 12);
+        expect(buffer.try_remove(0).has_value());
+        expect(buffer.try_pop_back().has_value());
+        expect(buffer.try_pop_front().has_value());
+        expect(buffer.capacity() == 16_i);
+        buffer.remove(0);
+        expect(buffer.capacity() == 8_i and buffer.empty());
+    };
+
+    "FixedPolicyCircBuf with GrowOnFull policy should store the growth"_test = [] {
+        using Grow = circbuf::FixedPolicyCircBuf<Type, circbuf::BufferPolicy::GrowOnFull>;
+
+        static_assert(sizeof(Grow) < sizeof(circbuf::CircBuf<Type>));
+
+        auto buffer = Grow{ 2, circbuf::Growth{ .factor = 3.0 } };
+        for (auto i : rv::iota(0, 7)) {
+            buffer.push_back(i);
+        }
+        expect(buffer.capacity() == 18_i);
+        expect(equal_underlying<Type>(buffer, rv::iota(0, 7)));
+        expect(that % buffer.growth().factor == 3.0);
+    };
+
     "unbalanced constructor/destructor means there is a bug in the code"_test = [] {
         expect(Type::active_instance_count() == 0_i) << "Unbalanced ctor/dtor detected!";
     };
 }
 
+// not trivially copyable but opted in as trivially relocatable
+struct Handle
+{
+    std::unique_ptr<int> m_value;
+
+    Handle(int value)
+        : m_value{ std::make_unique<int>(value) }
+    {
+    }
+
+    int value() const { return *m_value; }
+};
+
+template <>
+struct circbuf::IsTriviallyRelocatable<Handle> : std::true_type
+{
+};
+
+// trivially copyable elements go through the memcpy path
+void test_trivial()
+{
+    using namespace ut::operators;
+    using namespace ut::literals;
+    using ut::expect, ut::that, ut::throws;
+
+    "push_back_range and pop_front_n should copy trivially copyable elements in bulk"_test = [] {
+        auto buffer = circbuf::CircBuf<int>{ 10 };
+        populate_container(buffer, rv::iota(0, 16));
+
+        auto values = std::vector<int>{};
+        rr::copy(rv::iota(16, 24), std::back_inserter(values));
+
+        buffer.push_back_range(values);
+        expect(rr::equal(buffer, rv::iota(14, 24)));
+
+        buffer.push_back_range(std::span{ values }.subspan(0, 3));
+        expect(rr::equal(buffer, std::vector{ 17, 18, 19, 20, 21, 22, 23, 16, 17, 18 }));
+
+        auto out = std::array<int, 6>{};
+        expect(buffer.pop_front_n(out) == 6_u);
+        expect(rr::equal(out, rv::iota(17, 23)));
+        expect(buffer.size() == 4_u);
+        expect(buffer.front() == 23_i);
+    };
+    "insert_range and erase should shift trivially copyable elements in bulk"_test = [] {
+        auto buffer = circbuf::StaticCircBuf<int, 16>{};
+        auto model  = std::vector<int>{};
+        for (auto i : rv::iota(0, 24)) {
+            buffer.push_back(i);
+        }
+        rr::copy(rv::iota(8, 24), std::back_inserter(model));
+
+        buffer.erase(3, 9);
+        model.erase(model.begin() + 3, model.begin() + 9);
+        expect(rr::equal(buffer, model));
+
+        buffer.erase(7, 9);
+        model.erase(model.begin() + 7, model.begin() + 9);
+        expect(rr::equal(buffer, model));
+
+        auto values = std::array{ -1, -2, -3, -4, -5 };
+        buffer.insert_range(2, values);
+        model.insert(model.begin() + 2, values.begin(), values.end());
+        expect(rr::equal(buffer, model));
+
+        buffer.insert_range(10, std::span{ values }.first(3));
+        model.insert(model.begin() + 10, values.begin(), values.begin() + 3);
+        expect(rr::equal(buffer, model));
+        expect(buffer.full());
+    };
+
+    "prepare/commit and peek/consume should write and read the slots in place across the wrap around"_test = [] {
+        auto buffer = circbuf::CircBuf<int>{ 10 };
+        populate_container(buffer, rv::iota(0, 7));
+        auto out = std::array<int, 5>{};
+        buffer.pop_front_n(out);    // head at 5, two elements
+
+        auto [first, second] = buffer.prepare(6);
+        expect(first.size() == 3_u and second.size() == 3_u);
+        rr::copy(rv::iota(7, 10), first.begin());
+        rr::copy(rv::iota(10, 13), second.begin());
+
+        buffer.commit(5);    // the last prepared slot is left out
+        expect(rr::equal(buffer, rv::iota(5, 12)));
+
+        expect(buffer.prepare(42).size() == 3_u);
+        expect(throws([&] { buffer.commit(4); })) << "should throw when committing more than the free slots";
+
+        auto peeked = buffer.peek(6);
+        expect(peeked.size() == 6_u);
+        expect(rr::equal(peeked.first, rv::iota(5, 10)));
+        expect(rr::equal(peeked.second, rv::iota(10, 11)));
+
+        buffer.consume(4);
+        expect(rr::equal(buffer, rv::iota(9, 12)));
+        expect(buffer.peek(42).size() == 3_u);
+        expect(throws([&] { buffer.consume(4); })) << "should throw when consuming more than the elements";
+
+        buffer.consume(3);
+        expect(buffer.empty() and buffer.peek(1).empty());
+        expect(buffer.prepare(42).size() == 10_u);
+    };
+
+    "trivially relocatable elements should be relocated in bulk"_test = [] {
+        static_assert(circbuf::TriviallyRelocatable<Handle> and not std::is_trivially_copyable_v<Handle>);
+
+        auto values = [](auto&& range) { return range | rv::transform(&Handle::value); };
+
+        auto buffer = circbuf::CircBuf<Handle>{ 8 };
+        for (auto i : rv::iota(0, 12)) {
+            buffer.push_back(i);
+        }
+        buffer.pop_front();
+        buffer.pop_front();    // head at 6, wraps around
+
+        buffer.insert(1, 42);
+        buffer.insert(5, 43);
+        expect(buffer.remove(2).value() == 7_i);
+        expect(rr::equal(values(buffer), std::vector{ 6, 42, 8, 9, 43, 10, 11 }));
+
+        buffer.resize(6);
+        expect(rr::equal(values(buffer), std::vector{ 42, 8, 9, 43, 10, 11 }));
+
+        buffer.pop_front();
+        buffer.pop_front();
+        buffer.push_back(12);    // wraps around, not full
+        buffer.linearize();
+        expect(buffer.linearized() and rr::equal(values(buffer.data()), std::vector{ 9, 43, 10, 11, 12 }));
+
+        auto inline_buffer = circbuf::StaticCircBuf<Handle, 4>{};
+        for (auto i : rv::iota(0, 6)) {
+            inline_buffer.push_back(i);
+        }
+        auto moved = std::move(inline_buffer);
+        expect(inline_buffer.empty() and rr::equal(values(moved), rv::iota(2, 6)));
+    };
+}
+
 int main()
 {
     test_util::for_each_tuple<test_util::NonTrivialPermutations>([]<typename T>() {
@@ -429,4 +1240,6 @@ int main()
             test<T>();
         }
     });
+
+    test_trivial();
 }
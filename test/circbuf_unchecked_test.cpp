@@ -0,0 +1,3 @@
+// the CircBuf tests again, with CircBuf::iterator being CircBuf::UncheckedIterator
+#define CIRCBUF_CHECKED_ITERATOR 0
+#include "circbuf_test.cpp"
@@ -0,0 +1,58 @@
+#include <circbuf/concurrent.hpp>
+
+#include <boost/ut.hpp>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <ranges>
+#include <thread>
+
+namespace ut = boost::ut;
+namespace rr = std::ranges;
+
+int main()
+{
+    using namespace ut::operators;
+    using namespace ut::literals;
+    using ut::expect;
+
+    "ParkWait should only wake when a thread is parked on the notified word"_test = [] {
+        auto wait  = circbuf::ParkWait{};
+        auto word  = std::atomic<std::size_t>{ 0 };
+        auto other = std::array<std::atomic<std::size_t>, 8>{};
+
+        auto slot  = circbuf::detail::park_slot(&word);
+        auto apart = [&](auto& candidate) { return circbuf::detail::park_slot(&candidate) != slot; };
+        auto found = rr::find_if(other, apart);
+        expect(found != other.end()) << "neighbouring words should not all share a slot";
+
+        for (auto i = 0; i < 100; ++i) {
+            wait.notify(word);
+        }
+        expect(wait.wakes() == 0_u) << "nothing is parked yet";
+
+        auto waiter = std::jthread{ [&] {
+            wait.wait(word, [&] { return word.load(std::memory_order::acquire) != 0; });
+        } };
+
+        // word is unchanged so a notify doesn't release the waiter, it only tells us that it is parked
+        while (wait.wakes() == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds{ 1 });
+            wait.notify(word);
+        }
+        auto wakes = wait.wakes();
+
+        for (auto i = 0; i < 1000; ++i) {
+            found->store(static_cast<std::size_t>(i), std::memory_order::release);
+            wait.notify(*found);
+        }
+        expect(wait.wakes() == wakes) << "a thread parked on another word should not make notify wake";
+
+        word.store(1, std::memory_order::release);
+        wait.notify(word);
+        waiter.join();
+        expect(wait.wakes() == wakes + 1);
+    };
+}
@@ -0,0 +1,106 @@
+#include "test_util.hpp"
+
+#include <circbuf/detail/inline_buffer.hpp>
+
+#include <boost/ut.hpp>
+#include <fmt/core.h>
+
+#include <cassert>
+#include <ranges>
+#include <vector>
+
+namespace ut = boost::ut;
+namespace rr = std::ranges;
+namespace rv = rr::views;
+
+template <test_util::TestClass Type>
+void test()
+{
+    using namespace ut::operators;
+    using namespace ut::literals;
+    using ut::expect, ut::that;
+
+    Type::reset_active_instance_count();
+
+    "nrvo should happen"_test = [] {
+        circbuf::detail::InlineBuffer<Type, 10> buffer;
+        for (auto i : rv::iota(0u, 10u)) {
+            buffer.construct(i, 10 - i + 1);
+        }
+
+        for (auto i : rv::iota(0u, 10u)) {
+            auto&& value = buffer.at(i);
+            expect(that % value.value() == 10 - i + 1);
+            fmt::println("stat: {}", value.stat());
+        }
+
+        if constexpr (Type::is_movable() or Type::is_copyable()) {
+            for (auto i : rv::iota(0u, 10u)) {
+                auto value = std::move(buffer.at(i));
+                expect(that % value.value() == 10 - i + 1);
+                expect(that % value.stat().nocopy() or not Type::s_movable) << fmt::format(
+                    "copy shouldn't be made on '{}': {}", ut::reflection::type_name<Type>(), value.stat()
+                );
+                buffer.destroy(i);
+            }
+        } else {
+            for (auto i : rv::iota(0u, 10u)) {
+                buffer.destroy(i);
+            }
+        }
+    };
+
+    "memory should live inside the object itself"_test = [] {
+        using Buffer = circbuf::detail::InlineBuffer<Type, 10>;
+        static_assert(Buffer::size() == 10);
+        static_assert(sizeof(Buffer) >= sizeof(Type) * 10);
+        static_assert(alignof(Buffer) >= alignof(Type));
+
+        Buffer buffer;
+        auto*  begin = reinterpret_cast<const std::byte*>(&buffer);
+        auto*  data  = reinterpret_cast<const std::byte*>(buffer.data());
+        expect(data >= begin and data + sizeof(Type) * 10 <= begin + sizeof(Buffer));
+    };
+
+    "construct_n and destroy_n should construct and destroy a run of elements"_test = [] {
+        circbuf::detail::InlineBuffer<Type, 10> buffer;
+        auto values = std::vector{ 4, 8, 15, 16, 23, 42 };
+
+        auto it = buffer.construct_n(2, values.begin(), values.size());
+        expect(it == values.end());
+        for (auto i : rv::iota(std::size_t{ 0 }, values.size())) {
+            expect(that % buffer.at(2 + i).value() == values[i]);
+        }
+
+        buffer.destroy_n(2, values.size());
+    };
+
+    if constexpr (std::is_move_constructible_v<Type>) {
+        "relocate_n should move a run of elements to overlapping slots in both directions"_test = [] {
+            circbuf::detail::InlineBuffer<Type, 10> buffer;
+            auto values = std::vector{ 4, 8, 15, 16, 23, 42 };
+            buffer.construct_n(1, values.begin(), values.size());
+
+            buffer.relocate_n(3, 1, values.size());    // [1, 7) -> [3, 9)
+            for (auto i : rv::iota(std::size_t{ 0 }, values.size())) {
+                expect(that % buffer.at(3 + i).value() == values[i]);
+            }
+
+            buffer.relocate_n(0, 3, values.size());    // [3, 9) -> [0, 6)
+            for (auto i : rv::iota(std::size_t{ 0 }, values.size())) {
+                expect(that % buffer.at(i).value() == values[i]);
+            }
+
+            buffer.destroy_n(0, values.size());
+        };
+    }
+
+    "unbalanced constructor/destructor means there is a bug in the code"_test = [] {
+        expect(Type::active_instance_count() == 0_i) << "Unbalanced ctor/dtor detected!";
+    };
+}
+
+int main()
+{
+    test_util::for_each_tuple<test_util::NonTrivialPermutations>([]<typename T>() { test<T>(); });
+}
@@ -0,0 +1,144 @@
+#include <circbuf/io.hpp>
+
+#include <boost/ut.hpp>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <ranges>
+#include <vector>
+
+namespace ut = boost::ut;
+namespace rr = std::ranges;
+namespace rv = rr::views;
+
+// closes both ends on destruction
+struct Pipe
+{
+    std::array<int, 2> m_fds = { -1, -1 };
+
+    int read_end() const { return m_fds[0]; }
+    int write_end() const { return m_fds[1]; }
+
+    ~Pipe()
+    {
+        for (auto fd : m_fds) {
+            if (fd != -1) {
+                ::close(fd);
+            }
+        }
+    }
+};
+
+static std::vector<std::byte> make_bytes(int first, int last)
+{
+    auto bytes = std::vector<std::byte>{};
+    for (auto i : rv::iota(first, last)) {
+        bytes.push_back(static_cast<std::byte>(i));
+    }
+    return bytes;
+}
+
+// head in the middle of the underlying buffer so the free space and the elements both wrap around
+static circbuf::CircBuf<std::byte> make_wrapped_buffer(std::size_t capacity, std::size_t size)
+{
+    auto buffer = circbuf::CircBuf<std::byte>{ capacity };
+    buffer.push_back_range(make_bytes(0, static_cast<int>(capacity / 2)));
+    buffer.push_back(std::byte{ 0 });
+    buffer.consume(capacity / 2);    // not emptied, the head stays where it is
+    buffer.push_back_range(make_bytes(1, static_cast<int>(size)));
+    return buffer;
+}
+
+int main()
+{
+    using namespace ut::operators;
+    using namespace ut::literals;
+    using ut::expect, ut::that;
+
+    "read should fill both segments of the free space in one call"_test = [] {
+        auto pipe = Pipe{};
+        expect(::pipe(pipe.m_fds.data()) == 0_i);
+
+        auto buffer = make_wrapped_buffer(16, 2);
+        auto bytes  = make_bytes(2, 32);
+        expect(::write(pipe.write_end(), bytes.data(), bytes.size()) == 30_i);
+
+        expect(circbuf::io::read(pipe.read_end(), buffer, 10) == 10_i) << "should read at most count bytes";
+        expect(circbuf::io::read(pipe.read_end(), buffer) == 4_i) << "should read at most the free space";
+        expect(buffer.full() and not buffer.linearized());
+        expect(rr::equal(buffer, make_bytes(0, 16)));
+
+        errno = 0;
+        expect(circbuf::io::read(pipe.read_end(), buffer) == -1_i) << "full buffer should not look like end of file";
+        expect(errno == ENOBUFS);
+        expect(rr::equal(buffer, make_bytes(0, 16)));
+
+        buffer.consume(4);
+        errno = 0;
+        expect(circbuf::io::read(pipe.read_end(), buffer, 0) == -1_i) << "count 0 should not look like end of file";
+        expect(errno == ENOBUFS);
+
+        expect(circbuf::io::read(pipe.read_end(), buffer) == 4_i) << "the rest should still be readable";
+    };
+
+    "read should report ENOBUFS for an empty GrowOnFull buffer instead of end of file"_test = [] {
+        auto pipe = Pipe{};
+        expect(::pipe(pipe.m_fds.data()) == 0_i);
+        expect(::write(pipe.write_end(), "abcd", 4) == 4_i);
+
+        auto buffer = circbuf::CircBuf<std::byte>{ 0, circbuf::Growth{} };
+        errno       = 0;
+        expect(circbuf::io::read(pipe.read_end(), buffer) == -1_i);
+        expect(errno == ENOBUFS);
+
+        buffer.resize(8);
+        expect(circbuf::io::read(pipe.read_end(), buffer) == 4_i);
+    };
+
+    "write should drain both segments of the elements in one call"_test = [] {
+        auto pipe = Pipe{};
+        expect(::pipe(pipe.m_fds.data()) == 0_i);
+
+        auto buffer = make_wrapped_buffer(16, 14);
+        expect(circbuf::io::write(pipe.write_end(), buffer, 4) == 4_i) << "should write at most count bytes";
+        expect(circbuf::io::write(pipe.write_end(), buffer) == 10_i);
+        expect(buffer.empty());
+        expect(circbuf::io::write(pipe.write_end(), buffer) == 0_i) << "should write nothing when empty";
+
+        auto received = std::vector<std::byte>(14);
+        expect(::read(pipe.read_end(), received.data(), received.size()) == 14_i);
+        expect(rr::equal(received, make_bytes(0, 14)));
+    };
+
+    "bytes should go through a socketpair unchanged across many wrap arounds"_test = [] {
+        auto sockets = Pipe{};
+        expect(::socketpair(AF_UNIX, SOCK_STREAM, 0, sockets.m_fds.data()) == 0_i);
+
+        auto source = circbuf::CircBuf<std::byte>{ 61 };
+        auto sink   = circbuf::CircBuf<std::byte>{ 37 };
+        auto sent   = make_bytes(0, 2000);
+        auto input  = std::span{ sent };
+        auto output = std::vector<std::byte>{};
+
+        while (output.size() < sent.size()) {
+            auto chunk = std::min(input.size(), source.capacity() - source.size());
+            source.push_back_range(input.first(chunk));
+            input = input.subspan(chunk);
+
+            if (not source.empty()) {
+                expect(circbuf::io::write(sockets.m_fds[0], source, 23) > 0_i);
+            }
+
+            expect(circbuf::io::read(sockets.m_fds[1], sink) > 0_i);
+            while (not sink.empty()) {
+                output.push_back(sink.pop_front());
+            }
+        }
+
+        expect(rr::equal(output, sent));
+    };
+}
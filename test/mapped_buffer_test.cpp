@@ -0,0 +1,107 @@
+#include <circbuf/mapped_circbuf.hpp>
+
+#include <boost/ut.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <ranges>
+#include <vector>
+
+namespace ut = boost::ut;
+namespace rr = std::ranges;
+namespace rv = rr::views;
+
+// not trivially copyable but opted in as trivially relocatable
+struct Handle
+{
+    std::unique_ptr<int> m_value;
+
+    Handle(int value)
+        : m_value{ std::make_unique<int>(value) }
+    {
+    }
+
+    int value() const { return *m_value; }
+};
+
+template <>
+struct circbuf::IsTriviallyRelocatable<Handle> : std::true_type
+{
+};
+
+int main()
+{
+    using namespace ut::operators;
+    using namespace ut::literals;
+    using ut::expect, ut::that;
+
+    "grow should keep the elements at the same offsets"_test = [] {
+        auto buffer = circbuf::detail::MappedBuffer<int>{ 10 };
+        for (auto i : rv::iota(0, 10)) {
+            buffer.construct(static_cast<std::size_t>(i), i);
+        }
+
+        buffer.grow(1'000'000);    // way past the first page, the mapping most likely moves
+        expect(buffer.size() == 1'000'000_u);
+        expect(rr::equal(std::span{ buffer.data(), 10 }, rv::iota(0, 10)));
+
+        buffer.construct(999'999, 42);
+        expect(buffer.at(999'999) == 42_i);
+
+        buffer.destroy_n(0, 10);
+        buffer.destroy(999'999);
+
+        auto empty = circbuf::detail::MappedBuffer<int>{};
+        empty.grow(3);
+        expect(empty.size() == 3_u and empty.data() != nullptr);
+    };
+
+    "resize should move the part at the start after the old end when it is shorter"_test = [] {
+        auto buffer = circbuf::MappedCircBuf<int>{ 8 };
+        for (auto i : rv::iota(0, 11)) {
+            buffer.push_back(i);    // head at 3, three elements at the start
+        }
+
+        buffer.resize(16);
+        expect(buffer.capacity() == 16_u);
+        expect(rr::equal(buffer, rv::iota(3, 11)));
+        expect(buffer.segments().second.empty()) << "should not wrap around anymore";
+
+        for (auto i : rv::iota(11, 30)) {
+            buffer.push_back(i);
+        }
+        expect(rr::equal(buffer, rv::iota(14, 30)));
+    };
+
+    "resize should move the part at the old end to the new end when it is shorter"_test = [] {
+        auto buffer = circbuf::MappedCircBuf<Handle>{ 8 };
+        for (auto i : rv::iota(0, 15)) {
+            buffer.push_back(i);    // head at 7, a single element at the old end
+        }
+
+        buffer.resize(10);
+        expect(buffer.capacity() == 10_u);
+        expect(rr::equal(buffer | rv::transform(&Handle::value), rv::iota(7, 15)));
+
+        buffer.push_back(15);
+        buffer.push_back(16);
+        buffer.push_back(17);
+        expect(rr::equal(buffer | rv::transform(&Handle::value), rv::iota(8, 18)));
+    };
+
+    "shrinking should still discard elements according to the policy"_test = [] {
+        auto buffer = circbuf::MappedCircBuf<int, circbuf::BufferCapacityPolicy::PowerOfTwo>{ 8 };
+        for (auto i : rv::iota(0, 12)) {
+            buffer.push_back(i);
+        }
+
+        buffer.resize(4, circbuf::BufferResizePolicy::DiscardNew);
+        expect(buffer.capacity() == 4_u);
+        expect(rr::equal(buffer, rv::iota(4, 8)));
+
+        buffer.resize(32);
+        buffer.push_back(8);
+        expect(buffer.capacity() == 32_u);
+        expect(rr::equal(buffer, rv::iota(4, 9)));
+    };
+}
@@ -0,0 +1,99 @@
+#include <circbuf/mirrored_circbuf.hpp>
+
+#include <boost/ut.hpp>
+
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <ranges>
+#include <vector>
+
+namespace ut = boost::ut;
+namespace rr = std::ranges;
+namespace rv = rr::views;
+
+struct Sample
+{
+    std::int64_t m_time;
+    float        m_value;
+};
+
+int main()
+{
+    using namespace ut::operators;
+    using namespace ut::literals;
+    using ut::expect, ut::that;
+
+    "size should be rounded up to fill whole pages"_test = [] {
+        auto page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+
+        auto bytes = circbuf::detail::MirroredBuffer<std::byte>{ 10 };
+        expect(that % bytes.size() == page);
+
+        auto samples = circbuf::detail::MirroredBuffer<Sample>{ page };
+        expect((samples.size() * sizeof(Sample)) % page == 0_u);
+        expect(that % samples.size() >= page);
+
+        auto empty = circbuf::detail::MirroredBuffer<int>{ 0 };
+        expect(empty.size() == 0_u and empty.data() == nullptr);
+    };
+
+    "both mappings should see the same elements"_test = [] {
+        auto buffer = circbuf::detail::MirroredBuffer<int>{ 1 };
+        auto size   = buffer.size();
+
+        for (auto i : rv::iota(std::size_t{ 0 }, size)) {
+            buffer.construct(i, static_cast<int>(i));
+        }
+        for (auto i : rv::iota(std::size_t{ 0 }, size)) {
+            expect(that % buffer.data()[size + i] == static_cast<int>(i));
+        }
+
+        buffer.data()[size + 3] = 42;
+        expect(buffer.at(3) == 42_i);
+
+        buffer.destroy_n(0, size);
+    };
+
+    "data should be contiguous regardless of the head position"_test = [] {
+        auto buffer   = circbuf::MirroredCircBuf<int>{ 10 };
+        auto capacity = static_cast<int>(buffer.capacity());
+
+        for (auto i : rv::iota(0, capacity + capacity / 2)) {
+            buffer.push_back(i);
+        }
+        expect(buffer.full() and buffer.linearized());
+        expect(rr::equal(buffer.data(), rv::iota(capacity / 2, capacity + capacity / 2)));
+        expect(buffer.data().data() == buffer.segments().first.data() and buffer.segments().second.empty());
+
+        buffer.pop_front();
+        buffer.pop_back();
+        auto data = buffer.data();
+        expect(rr::equal(data, rv::iota(capacity / 2 + 1, capacity + capacity / 2 - 1)));
+        expect(&buffer.linearize() == &buffer and data.data() == buffer.data().data()) << "should not move";
+    };
+
+    "the buffer should keep working after resize and move"_test = [] {
+        auto buffer = circbuf::MirroredCircBuf<std::byte>{ 1 };
+        auto page   = buffer.capacity();
+
+        for (auto i : rv::iota(std::size_t{ 0 }, page + 7)) {
+            buffer.push_back(static_cast<std::byte>(i));
+        }
+
+        buffer.resize(page + 1);
+        expect(that % buffer.capacity() == 2 * page);
+        expect(that % buffer.size() == page);
+        expect(buffer.front() == std::byte{ 7 });
+
+        auto moved = std::move(buffer);
+        expect(that % moved.size() == page);
+        expect(buffer.capacity() == 0_u);
+
+        auto [first, second] = moved.prepare(page);
+        expect(first.size() == page and second.empty());
+        moved.commit(page);
+        expect(moved.full() and moved.data().size() == 2 * page);
+    };
+}
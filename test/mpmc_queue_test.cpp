@@ -0,0 +1,201 @@
+#include "test_util.hpp"
+
+#include <circbuf/mpmc_queue.hpp>
+
+#include <boost/ut.hpp>
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <deque>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+namespace ut = boost::ut;
+namespace rr = std::ranges;
+namespace rv = rr::views;
+
+template <test_util::TestClass Type>
+void test()
+{
+    using namespace ut::operators;
+    using namespace ut::literals;
+    using ut::expect, ut::that, ut::throws;
+
+    Type::reset_active_instance_count();
+
+    "capacity should be rounded up to the next power of two"_test = [] {
+        expect(circbuf::MpmcQueue<Type>{ 1 }.capacity() == 1_u);
+        expect(circbuf::MpmcQueue<Type>{ 10 }.capacity() == 16_u);
+        expect(circbuf::MpmcQueue<Type>{ 16 }.capacity() == 16_u);
+
+        using circbuf::error::ZeroCapacity;
+        expect(throws<ZeroCapacity>([] { circbuf::MpmcQueue<Type>{ 0 }; })) << "zero capacity is not allowed";
+    };
+
+    "try_push should fail when full and try_pop should fail when empty"_test = [] {
+        auto queue = circbuf::MpmcQueue<Type>{ 8 };
+        expect(queue.empty());
+        expect(not queue.try_pop().has_value());
+
+        for (auto i : rv::iota(0, 8)) {
+            expect(queue.try_push(i));
+        }
+        expect(queue.full());
+        expect(not queue.try_push(42)) << "push to a full queue should fail";
+
+        for (auto i : rv::iota(0, 8)) {
+            auto value = queue.try_pop();
+            expect(value.has_value() and value->value() == i);
+        }
+        expect(queue.empty());
+        expect(not queue.try_pop().has_value());
+    };
+
+    "elements should come out in the same order they went in across wrap around"_test = [] {
+        auto queue = circbuf::MpmcQueue<Type>{ 4 };
+        auto model = std::deque<int>{};
+
+        for (auto i : rv::iota(0, 100)) {
+            if (i % 2 == 0) {
+                expect(queue.try_emplace(i));
+            } else {
+                queue.emplace(i);
+            }
+            model.push_back(i);
+
+            if (i % 3 == 0) {
+                queue.push(-i);
+                model.push_back(-i);
+            }
+
+            while (model.size() > 2) {
+                auto value = i % 5 == 0 ? queue.pop() : *queue.try_pop();
+                expect(that % value.value() == model.front());
+                model.pop_front();
+            }
+        }
+        expect(that % queue.size() == model.size());
+    };
+
+    "elements left in the queue should be destroyed"_test = [] {
+        {
+            auto queue = circbuf::MpmcQueue<Type>{ 8 };
+            for (auto i : rv::iota(0, 13)) {
+                queue.try_push(i);
+                if (i % 4 == 0) {
+                    queue.pop();
+                }
+            }
+        }
+        expect(Type::active_instance_count() == 0_i);
+    };
+
+    "unbalanced constructor/destructor means there is a bug in the code"_test = [] {
+        expect(Type::active_instance_count() == 0_i) << "Unbalanced ctor/dtor detected!";
+    };
+}
+
+int main()
+{
+    test_util::for_each_tuple<test_util::NonTrivialPermutations>([]<typename T>() {
+        if constexpr (circbuf::ConcurrentElement<T>) {
+            test<T>();
+        }
+    });
+
+    using namespace ut::literals;
+    using ut::expect, ut::that;
+
+    // every producer pushes its own increasing values: each consumer must see them in order for every producer,
+    // and together the consumers must see every value exactly once
+    "values should be transferred exactly once between many producers and consumers"_test = [] {
+        constexpr auto producers = 4;
+        constexpr auto consumers = 4;
+        constexpr auto count     = 50'000;
+
+        auto queue    = circbuf::MpmcQueue<int>{ 64 };
+        auto received = std::vector<std::vector<int>>(consumers);
+
+        {
+            auto threads = std::vector<std::jthread>{};
+
+            for (auto c : rv::iota(0, consumers)) {
+                threads.emplace_back([&, c] {
+                    for (auto i = 0; i < count; ++i) {
+                        if (c % 2 == 0) {
+                            received[c].push_back(queue.pop());
+                        } else {
+                            auto value = queue.try_pop();
+                            while (not value.has_value()) {
+                                value = queue.try_pop();
+                            }
+                            received[c].push_back(*value);
+                        }
+                    }
+                });
+            }
+
+            for (auto p : rv::iota(0, producers)) {
+                threads.emplace_back([&, p] {
+                    for (auto i = 0; i < count; ++i) {
+                        auto value = p * count + i;
+                        if (p % 2 == 0) {
+                            queue.push(value);
+                        } else {
+                            while (not queue.try_push(value)) { }
+                        }
+                    }
+                });
+            }
+        }
+
+        auto all = std::vector<int>{};
+        for (const auto& values : received) {
+            for (auto p : rv::iota(0, producers)) {
+                auto mine = values | rv::filter([&](int value) { return value / count == p; });
+                expect(rr::is_sorted(mine)) << "values of a producer should stay in order";
+            }
+            all.insert(all.end(), values.begin(), values.end());
+        }
+
+        rr::sort(all);
+        expect(rr::equal(all, rv::iota(0, producers * count)));
+        expect(queue.empty());
+    };
+
+    "blocking push and pop should sleep and wake up with ParkWait"_test = [] {
+        constexpr auto threads = 2;
+        constexpr auto count   = 20'000;
+
+        auto queue    = circbuf::MpmcQueue<int, circbuf::ParkWait>{ 8 };
+        auto received = std::vector<std::vector<int>>(threads);
+
+        {
+            auto workers = std::vector<std::jthread>{};
+            for (auto t : rv::iota(0, threads)) {
+                workers.emplace_back([&, t] {
+                    for (auto i = 0; i < count; ++i) {
+                        received[t].push_back(queue.pop());
+                    }
+                });
+            }
+            for (auto t : rv::iota(0, threads)) {
+                workers.emplace_back([&, t] {
+                    for (auto i = 0; i < count; ++i) {
+                        queue.push(t * count + i);
+                    }
+                });
+            }
+        }
+
+        auto all = std::vector<int>{};
+        for (const auto& values : received) {
+            all.insert(all.end(), values.begin(), values.end());
+        }
+
+        rr::sort(all);
+        expect(rr::equal(all, rv::iota(0, threads * count)));
+        expect(queue.empty());
+    };
+}
@@ -7,6 +7,7 @@
 
 #include <cassert>
 #include <ranges>
+#include <vector>
 
 namespace ut = boost::ut;
 namespace rr = std::ranges;
@@ -49,6 +50,39 @@ void test()
         }
     };
 
+    "construct_n and destroy_n should construct and destroy a run of elements"_test = [] {
+        circbuf::detail::RawBuffer<Type> buffer{ 10 };
+        auto values = std::vector{ 4, 8, 15, 16, 23, 42 };
+
+        auto it = buffer.construct_n(2, values.begin(), values.size());
+        expect(it == values.end());
+        for (auto i : rv::iota(std::size_t{ 0 }, values.size())) {
+            expect(that % buffer.at(2 + i).value() == values[i]);
+        }
+
+        buffer.destroy_n(2, values.size());
+    };
+
+    if constexpr (std::is_move_constructible_v<Type>) {
+        "relocate_n should move a run of elements to overlapping slots in both directions"_test = [] {
+            circbuf::detail::RawBuffer<Type> buffer{ 10 };
+            auto values = std::vector{ 4, 8, 15, 16, 23, 42 };
+            buffer.construct_n(1, values.begin(), values.size());
+
+            buffer.relocate_n(3, 1, values.size());    // [1, 7) -> [3, 9)
+            for (auto i : rv::iota(std::size_t{ 0 }, values.size())) {
+                expect(that % buffer.at(3 + i).value() == values[i]);
+            }
+
+            buffer.relocate_n(0, 3, values.size());    // [3, 9) -> [0, 6)
+            for (auto i : rv::iota(std::size_t{ 0 }, values.size())) {
+                expect(that % buffer.at(i).value() == values[i]);
+            }
+
+            buffer.destroy_n(0, values.size());
+        };
+    }
+
     "unbalanced constructor/destructor means there is a bug in the code"_test = [] {
         expect(Type::active_instance_count() == 0_i) << "Unbalanced ctor/dtor detected!";
     };
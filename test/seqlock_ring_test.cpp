@@ -0,0 +1,125 @@
+#include <circbuf/seqlock_ring.hpp>
+
+#include <boost/ut.hpp>
+#include <fmt/core.h>
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+namespace ut = boost::ut;
+namespace rr = std::ranges;
+namespace rv = rr::views;
+
+// wide enough that a torn copy would show up as fields that don't agree with each other
+struct Sample
+{
+    std::uint64_t sequence;
+    std::uint64_t doubled;
+    std::array<std::uint64_t, 6> payload;
+
+    static Sample make(std::uint64_t sequence)
+    {
+        auto sample = Sample{ sequence, sequence * 2, {} };
+        sample.payload.fill(~sequence);
+        return sample;
+    }
+
+    bool consistent() const
+    {
+        return doubled == sequence * 2 and rr::all_of(payload, [&](auto value) { return value == ~sequence; });
+    }
+};
+
+int main()
+{
+    using namespace ut::operators;
+    using namespace ut::literals;
+    using ut::expect, ut::that, ut::throws;
+
+    "capacity should be rounded up to the next power of two"_test = [] {
+        expect(circbuf::SeqlockRing<int>{ 1 }.capacity() == 1_u);
+        expect(circbuf::SeqlockRing<int>{ 10 }.capacity() == 16_u);
+        expect(circbuf::SeqlockRing<int>{ 16 }.capacity() == 16_u);
+
+        using circbuf::error::ZeroCapacity;
+        expect(throws<ZeroCapacity>([] { circbuf::SeqlockRing<int>{ 0 }; })) << "zero capacity is not allowed";
+    };
+
+    "snapshot should return the latest elements oldest first"_test = [] {
+        auto ring = circbuf::SeqlockRing<int>{ 4 };
+        auto out  = std::array<int, 8>{};
+
+        expect(ring.empty());
+        expect(not ring.latest().has_value());
+        expect(ring.snapshot(out) == 0_u);
+
+        ring.push(0);
+        ring.push(1);
+        ring.push(2);
+        expect(ring.size() == 3_u);
+        expect(ring.snapshot(out) == 3_u);
+        expect(rr::equal(std::span{ out }.first(3), rv::iota(0, 3)));
+
+        for (auto i : rv::iota(3, 11)) {
+            ring.push(i);
+        }
+        expect(ring.size() == 4_u and ring.pushed() == 11_u);
+        expect(ring.snapshot(out) == 4_u) << "only capacity() elements are kept";
+        expect(rr::equal(std::span{ out }.first(4), rv::iota(7, 11)));
+
+        expect(ring.try_snapshot(std::span{ out }.first(2)) == 2_u);
+        expect(rr::equal(std::span{ out }.first(2), rv::iota(9, 11)));
+        expect(ring.latest() == 10);
+    };
+
+    "readers should only ever see consistent consecutive windows while the writer keeps going"_test = [] {
+        constexpr auto count   = std::uint64_t{ 200'000 };
+        constexpr auto readers = 3;
+
+        auto ring      = circbuf::SeqlockRing<Sample>{ 32 };
+        auto done      = std::atomic<bool>{ false };
+        auto snapshots = std::vector<std::size_t>(readers);
+        auto failures  = std::vector<std::size_t>(readers);
+
+        {
+            auto threads = std::vector<std::jthread>{};
+
+            for (auto r : rv::iota(0, readers)) {
+                threads.emplace_back([&, r] {
+                    auto out  = std::vector<Sample>(r == 0 ? 32 : 8);
+                    auto last = std::uint64_t{ 0 };
+
+                    while (not done.load()) {
+                        auto n      = ring.snapshot(out);
+                        auto window = std::span{ out }.first(n);
+
+                        for (auto i : rv::iota(std::size_t{ 0 }, n)) {
+                            failures[r] += not window[i].consistent();
+                            failures[r] += i > 0 and window[i].sequence != window[i - 1].sequence + 1;
+                        }
+                        if (n > 0) {
+                            failures[r] += window.back().sequence < last;
+                            last         = window.back().sequence;
+                        }
+                        ++snapshots[r];
+                    }
+                });
+            }
+
+            for (auto i : rv::iota(std::uint64_t{ 0 }, count)) {
+                ring.push(Sample::make(i));
+            }
+            done.store(true);
+        }
+
+        for (auto r : rv::iota(0, readers)) {
+            expect(snapshots[r] > 0_u);
+            expect(that % failures[r] == 0) << "a torn or out of order snapshot got through";
+        }
+        expect(ring.latest()->sequence == count - 1);
+    };
+}
@@ -0,0 +1,154 @@
+#include "test_util.hpp"
+
+#include <circbuf/spsc_queue.hpp>
+
+#include <boost/ut.hpp>
+#include <fmt/core.h>
+
+#include <deque>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+namespace ut = boost::ut;
+namespace rr = std::ranges;
+namespace rv = rr::views;
+
+template <test_util::TestClass Type>
+void test()
+{
+    using namespace ut::operators;
+    using namespace ut::literals;
+    using ut::expect, ut::that, ut::throws;
+
+    Type::reset_active_instance_count();
+
+    "capacity should be rounded up to the next power of two"_test = [] {
+        expect(circbuf::SpscQueue<Type>{ 1 }.capacity() == 1_u);
+        expect(circbuf::SpscQueue<Type>{ 10 }.capacity() == 16_u);
+        expect(circbuf::SpscQueue<Type>{ 16 }.capacity() == 16_u);
+
+        using circbuf::error::ZeroCapacity;
+        expect(throws<ZeroCapacity>([] { circbuf::SpscQueue<Type>{ 0 }; })) << "zero capacity is not allowed";
+    };
+
+    "try_push should fail when full and try_pop should fail when empty"_test = [] {
+        auto queue = circbuf::SpscQueue<Type>{ 8 };
+        expect(queue.empty());
+        expect(not queue.try_pop().has_value());
+
+        for (auto i : rv::iota(0, 8)) {
+            expect(queue.try_push(i));
+        }
+        expect(queue.full());
+        expect(not queue.try_push(42)) << "push to a full queue should fail";
+
+        for (auto i : rv::iota(0, 8)) {
+            auto value = queue.try_pop();
+            expect(value.has_value() and value->value() == i);
+        }
+        expect(queue.empty());
+        expect(not queue.try_pop().has_value());
+    };
+
+    "elements should come out in the same order they went in across wrap around"_test = [] {
+        auto queue = circbuf::SpscQueue<Type>{ 4 };
+        auto model = std::deque<int>{};
+
+        for (auto i : rv::iota(0, 100)) {
+            expect(queue.try_emplace(i));
+            model.push_back(i);
+
+            if (i % 3 == 0) {
+                expect(queue.try_push(-i));
+                model.push_back(-i);
+            }
+
+            while (model.size() > 2) {
+                expect(that % queue.try_pop()->value() == model.front());
+                model.pop_front();
+            }
+        }
+        expect(that % queue.size() == model.size());
+    };
+
+    "elements left in the queue should be destroyed"_test = [] {
+        {
+            auto queue = circbuf::SpscQueue<Type>{ 8 };
+            for (auto i : rv::iota(0, 5)) {
+                queue.try_push(i);
+            }
+            queue.try_pop();
+        }
+        expect(Type::active_instance_count() == 0_i);
+    };
+
+    "unbalanced constructor/destructor means there is a bug in the code"_test = [] {
+        expect(Type::active_instance_count() == 0_i) << "Unbalanced ctor/dtor detected!";
+    };
+}
+
+int main()
+{
+    test_util::for_each_tuple<test_util::NonTrivialPermutations>([]<typename T>() {
+        if constexpr (circbuf::ConcurrentElement<T>) {
+            test<T>();
+        }
+    });
+
+    using namespace ut::literals;
+    using ut::expect, ut::that;
+
+    "values should be transferred in order between two threads"_test = [] {
+        constexpr auto count = 200'000;
+
+        auto queue    = circbuf::SpscQueue<int>{ 64 };
+        auto received = std::vector<int>{};
+        received.reserve(count);
+
+        auto consumer = std::jthread{ [&] {
+            while (received.size() < count) {
+                if (auto value = queue.try_pop(); value.has_value()) {
+                    received.push_back(*value);
+                }
+            }
+        } };
+
+        for (auto i : rv::iota(0, count)) {
+            while (not queue.try_push(i)) { }
+        }
+        consumer.join();
+
+        expect(rr::equal(received, rv::iota(0, count)));
+        expect(queue.empty());
+    };
+
+    "blocking push and pop should transfer values in order with every wait strategy"_test = [] {
+        auto transfer = []<circbuf::WaitStrategy W>() {
+            constexpr auto count = 20'000;
+
+            auto queue    = circbuf::SpscQueue<int, W>{ 16 };
+            auto received = std::vector<int>{};
+            received.reserve(count);
+
+            auto consumer = std::jthread{ [&] {
+                for (auto i = 0; i < count; ++i) {
+                    auto value = queue.try_pop();    // a try_pop in between must not lose a wake up
+                    received.push_back(value.has_value() ? *value : queue.pop());
+                }
+            } };
+
+            for (auto i : rv::iota(0, count)) {
+                queue.push(i);
+            }
+            consumer.join();
+
+            expect(rr::equal(received, rv::iota(0, count)));
+            expect(queue.empty());
+        };
+
+        transfer.operator()<circbuf::SpinWait>();
+        transfer.operator()<circbuf::YieldWait>();
+        transfer.operator()<circbuf::ParkWait>();
+    };
+}
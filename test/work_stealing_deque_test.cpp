@@ -0,0 +1,121 @@
+#include <circbuf/work_stealing_deque.hpp>
+
+#include <boost/ut.hpp>
+#include <fmt/core.h>
+
+#include <algorithm>
+#include <atomic>
+#include <ranges>
+#include <thread>
+#include <vector>
+
+namespace ut = boost::ut;
+namespace rr = std::ranges;
+namespace rv = rr::views;
+
+int main()
+{
+    using namespace ut::operators;
+    using namespace ut::literals;
+    using ut::expect, ut::that, ut::throws;
+
+    "capacity should be rounded up to the next power of two"_test = [] {
+        expect(circbuf::WorkStealingDeque<int>{ 1 }.capacity() == 1_u);
+        expect(circbuf::WorkStealingDeque<int>{ 10 }.capacity() == 16_u);
+        expect(circbuf::WorkStealingDeque<int>{ 16 }.capacity() == 16_u);
+
+        using circbuf::error::ZeroCapacity;
+        expect(throws<ZeroCapacity>([] { circbuf::WorkStealingDeque<int>{ 0 }; })) << "zero capacity";
+    };
+
+    "the owner should pop the newest element and thieves should steal the oldest"_test = [] {
+        auto deque = circbuf::WorkStealingDeque<int>{ 8 };
+        expect(deque.empty());
+        expect(not deque.pop().has_value());
+        expect(not deque.steal().has_value());
+
+        for (auto i : rv::iota(0, 6)) {
+            deque.push(i);
+        }
+        expect(deque.size() == 6_u);
+
+        expect(deque.pop() == 5);
+        expect(deque.steal() == 0);
+        expect(deque.steal() == 1);
+        expect(deque.pop() == 4);
+        expect(deque.size() == 2_u);
+
+        expect(deque.pop() == 3);
+        expect(deque.pop() == 2);
+        expect(not deque.pop().has_value());
+        expect(not deque.steal().has_value());
+        expect(deque.empty());
+    };
+
+    "the ring should grow when full and keep the elements in order across wrap around"_test = [] {
+        auto deque = circbuf::WorkStealingDeque<int>{ 4 };
+
+        // move the indices so that the elements wrap around when the ring grows
+        for (auto i : rv::iota(0, 3)) {
+            deque.push(i);
+            expect(deque.steal() == i);
+        }
+
+        for (auto i : rv::iota(0, 20)) {
+            deque.push(i);
+        }
+        expect(deque.capacity() == 32_u);
+        expect(deque.size() == 20_u);
+
+        for (auto i : rv::iota(0, 10)) {
+            expect(that % *deque.steal() == i);
+        }
+        for (auto i : rv::iota(10, 20) | rv::reverse) {
+            expect(that % *deque.pop() == i);
+        }
+        expect(deque.empty());
+    };
+
+    // the owner pushes and pops while the thieves steal: together they must get every value exactly once
+    "every value should be taken exactly once by the owner or a thief"_test = [] {
+        constexpr auto thieves = 3;
+        constexpr auto count   = 200'000;
+
+        auto deque  = circbuf::WorkStealingDeque<int>{ 16 };
+        auto done   = std::atomic<bool>{ false };
+        auto stolen = std::vector<std::vector<int>>(thieves);
+        auto popped = std::vector<int>{};
+
+        {
+            auto threads = std::vector<std::jthread>{};
+            for (auto t : rv::iota(0, thieves)) {
+                threads.emplace_back([&, t] {
+                    while (not done.load() or not deque.empty()) {
+                        if (auto value = deque.steal(); value.has_value()) {
+                            stolen[t].push_back(*value);
+                        }
+                    }
+                });
+            }
+
+            for (auto i : rv::iota(0, count)) {
+                deque.push(i);
+                if (i % 3 == 0) {
+                    if (auto value = deque.pop(); value.has_value()) {
+                        popped.push_back(*value);
+                    }
+                }
+            }
+            done.store(true);
+        }
+
+        auto all = popped;
+        for (const auto& values : stolen) {
+            expect(rr::is_sorted(values)) << "a thief should steal in push order";
+            all.insert(all.end(), values.begin(), values.end());
+        }
+
+        rr::sort(all);
+        expect(rr::equal(all, rv::iota(0, count)));
+    };
+}